@@ -1,11 +1,23 @@
 #pragma once
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <condition_variable>
+#include <deque>
 #include <fstream>
+#include <functional>
 #include <iomanip>
 #include <iostream>
+#include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
+#include <thread>
 #include <tuple>
+#include <utility>
 #include <vector>
 #include <vulkan/vulkan.hpp>
 
@@ -64,6 +76,10 @@ namespace vkCore
     inline uint32_t dataCopies               = 2U;
     inline uint32_t swapchainImageCount      = 0U;
     inline float queuePriority               = 1.0F;
+    inline uint64_t frameCounter             = 0U;    // Advanced by Sync::beginFrame().
+    inline bool timelineSemaphores           = false; // True if the device was created with the timeline semaphore feature enabled.
+    inline bool synchronization2             = false; // True if the device was created with VK_KHR_synchronization2 enabled.
+    inline bool externalMemoryHost           = false; // True if the device was created with VK_EXT_external_memory_host enabled.
   } // namespace global
 
   namespace details
@@ -112,27 +128,206 @@ namespace vkCore
       return result;
     }
 
+    /// Searches a pNext chain for a structure of the given type.
+    /// @param pNext The first element of the chain.
+    /// @return Returns a pointer to the structure or nullptr if the chain does not contain it.
+    template <typename T>
+    auto findInChain( const void* pNext ) -> const T*
+    {
+      for ( auto it = static_cast<const vk::BaseInStructure*>( pNext ); it != nullptr; it = it->pNext )
+      {
+        if ( it->sType == T::structureType )
+        {
+          return reinterpret_cast<const T*>( it );
+        }
+      }
+
+      return nullptr;
+    }
+
+    /// Checks if the timeline semaphore feature was enabled in the given device features.
+    /// @param features2 The features the device is created with.
+    /// @return Returns true if timeline semaphores can be used.
+    inline auto isTimelineSemaphoreEnabled( const std::optional<vk::PhysicalDeviceFeatures2>& features2 ) -> bool
+    {
+#ifdef VK_API_VERSION_1_2
+      if ( !features2.has_value( ) )
+      {
+        return false;
+      }
+
+      if ( auto features = findInChain<vk::PhysicalDeviceVulkan12Features>( features2->pNext ); features != nullptr && features->timelineSemaphore )
+      {
+        return true;
+      }
+
+      if ( auto features = findInChain<vk::PhysicalDeviceTimelineSemaphoreFeatures>( features2->pNext ); features != nullptr && features->timelineSemaphore )
+      {
+        return true;
+      }
+#endif
+
+      return false;
+    }
+
+    /// Checks if VK_KHR_synchronization2 and its feature were enabled for the device.
+    /// @param extensions The device extensions the device is created with.
+    /// @param features2 The features the device is created with.
+    /// @return Returns true if the synchronization2 commands can be used.
+    inline auto isSynchronization2Enabled( const std::vector<const char*>& extensions, const std::optional<vk::PhysicalDeviceFeatures2>& features2 ) -> bool
+    {
+#ifdef VK_KHR_synchronization2
+      if ( !features2.has_value( ) )
+      {
+        return false;
+      }
+
+      bool extensionEnabled = std::any_of( extensions.begin( ), extensions.end( ), []( const char* name ) { return strcmp( name, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME ) == 0; } );
+
+      auto features = findInChain<vk::PhysicalDeviceSynchronization2FeaturesKHR>( features2->pNext );
+      return extensionEnabled && features != nullptr && features->synchronization2;
+#else
+      return false;
+#endif
+    }
+
+#ifdef VK_KHR_synchronization2
+    /// Enables VK_KHR_synchronization2 for the device if the physical device supports it and the caller did not decide on the feature already.
+    ///
+    /// The extension is appended to the given extensions and the feature structure is chained in front of the given features.
+    /// @param extensions The device extensions the device is created with.
+    /// @param features The features the device is created with if no features2 are given. They are moved into features2 if the feature structure needs to be chained.
+    /// @param features2 The features the device is created with.
+    /// @param synchronization2Features The feature structure to chain. It must outlive the creation of the device.
+    inline void enableSynchronization2( std::vector<const char*>& extensions, const std::optional<vk::PhysicalDeviceFeatures>& features, std::optional<vk::PhysicalDeviceFeatures2>& features2, vk::PhysicalDeviceSynchronization2FeaturesKHR& synchronization2Features )
+    {
+      if ( features2.has_value( ) && findInChain<vk::PhysicalDeviceSynchronization2FeaturesKHR>( features2->pNext ) != nullptr )
+      {
+        return;
+      }
+
+      // Querying the feature requires Vulkan 1.1.
+      if ( global::physicalDevice.getProperties( ).apiVersion < VK_API_VERSION_1_1 )
+      {
+        return;
+      }
+
+      std::vector<vk::ExtensionProperties> properties = global::physicalDevice.enumerateDeviceExtensionProperties( );
+      if ( std::none_of( properties.begin( ), properties.end( ), []( const vk::ExtensionProperties& property ) { return strcmp( property.extensionName, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME ) == 0; } ) )
+      {
+        return;
+      }
+
+      auto supportedFeatures = global::physicalDevice.getFeatures2<vk::PhysicalDeviceFeatures2, vk::PhysicalDeviceSynchronization2FeaturesKHR>( );
+      if ( !supportedFeatures.get<vk::PhysicalDeviceSynchronization2FeaturesKHR>( ).synchronization2 )
+      {
+        return;
+      }
+
+      // pEnabledFeatures must be NULL if the VkDeviceCreateInfo::pNext chain includes VkPhysicalDeviceFeatures2.
+      if ( !features2.has_value( ) )
+      {
+        features2 = vk::PhysicalDeviceFeatures2( features.value_or( vk::PhysicalDeviceFeatures( ) ) );
+      }
+
+      synchronization2Features.synchronization2 = VK_TRUE;
+      synchronization2Features.pNext            = features2->pNext;
+      features2->pNext                          = &synchronization2Features;
+
+      if ( std::none_of( extensions.begin( ), extensions.end( ), []( const char* name ) { return strcmp( name, VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME ) == 0; } ) )
+      {
+        extensions.push_back( VK_KHR_SYNCHRONIZATION_2_EXTENSION_NAME );
+      }
+    }
+#endif
+
+    /// Checks if VK_EXT_external_memory_host was enabled for the device.
+    /// @param extensions The device extensions the device is created with.
+    /// @return Returns true if host memory can be imported.
+    inline auto isExternalMemoryHostEnabled( const std::vector<const char*>& extensions ) -> bool
+    {
+#ifdef VK_EXT_external_memory_host
+      return std::any_of( extensions.begin( ), extensions.end( ), []( const char* name ) { return strcmp( name, VK_EXT_EXTERNAL_MEMORY_HOST_EXTENSION_NAME ) == 0; } );
+#else
+      return false;
+#endif
+    }
+
   } // namespace details
 
   // --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
   // Utility Functions
   // --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-  inline auto findMemoryType( vk::PhysicalDevice physicalDevice, uint32_t typeFilter, vk::MemoryPropertyFlags properties ) -> uint32_t
+  /// Finds the best memory type for the given requirements.
+  ///
+  /// Every memory type that has all required properties is scored. Each preferred property adds to the score, while each property that was neither required nor preferred subtracts from it.
+  /// This way, e.g. plain device local memory is chosen over device local, host visible memory unless the latter is preferred explicitly.
+  /// @param physicalDevice The physical device to query the memory properties from.
+  /// @param typeFilter The memory type bits of the resource's memory requirements.
+  /// @param properties The properties the memory type must have.
+  /// @param preferredProperties The properties the memory type should have if possible.
+  /// @return Returns the index of the memory type with the highest score.
+  inline auto findMemoryType( vk::PhysicalDevice physicalDevice, uint32_t typeFilter, vk::MemoryPropertyFlags properties, vk::MemoryPropertyFlags preferredProperties = { } ) -> uint32_t
   {
     static vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties( );
 
+    auto countBits = []( vk::MemoryPropertyFlags flags ) {
+      int count = 0;
+      for ( auto bits = static_cast<uint32_t>( flags ); bits != 0U; bits &= bits - 1 )
+      {
+        ++count;
+      }
+
+      return count;
+    };
+
+    std::optional<uint32_t> result;
+    int bestScore = 0;
+
     for ( uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i )
     {
-      if ( ( ( typeFilter & ( 1 << i ) ) != 0U ) && ( memoryProperties.memoryTypes[i].propertyFlags & properties ) == properties )
+      vk::MemoryPropertyFlags flags = memoryProperties.memoryTypes[i].propertyFlags;
+
+      if ( ( ( typeFilter & ( 1 << i ) ) != 0U ) && ( flags & properties ) == properties )
       {
-        return i;
+        int score = 2 * countBits( flags & preferredProperties ) - countBits( flags & ~( properties | preferredProperties ) );
+
+        if ( !result.has_value( ) || score > bestScore )
+        {
+          result    = i;
+          bestScore = score;
+        }
       }
     }
 
-    VK_CORE_THROW( "vkCore: Failed to find suitable memory type." );
+    if ( !result.has_value( ) )
+    {
+      VK_CORE_THROW( "vkCore: Failed to find suitable memory type." );
+    }
+
+    return result.value( );
+  }
+
+  /// Returns the size of the largest memory heap that device local, host visible memory can be allocated from.
+  /// @param physicalDevice The physical device to query the memory properties from.
+  /// @return Returns the heap's size in bytes or zero if there is no such memory.
+  /// @note Without resizable BAR, the heap is usually limited to 256 MB.
+  inline auto getHostVisibleDeviceLocalHeapSize( vk::PhysicalDevice physicalDevice ) -> vk::DeviceSize
+  {
+    vk::PhysicalDeviceMemoryProperties memoryProperties = physicalDevice.getMemoryProperties( );
+    vk::MemoryPropertyFlags flags                       = vk::MemoryPropertyFlagBits::eDeviceLocal | vk::MemoryPropertyFlagBits::eHostVisible;
+
+    vk::DeviceSize size = 0;
+    for ( uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i )
+    {
+      if ( ( memoryProperties.memoryTypes[i].propertyFlags & flags ) == flags )
+      {
+        size = std::max( size, memoryProperties.memoryHeaps[memoryProperties.memoryTypes[i].heapIndex].size );
+      }
+    }
 
-    return 0U;
+    return size;
   }
 
   template <typename T>
@@ -525,6 +720,32 @@ namespace vkCore
     global::transferFamilyIndex = transferFamilyIndex.value( );
   }
 
+#ifdef VK_EXT_external_memory_host
+  /// @return Returns the alignment of host pointers and sizes imported using VK_EXT_external_memory_host.
+  /// @note The device must have been created with VK_EXT_external_memory_host enabled.
+  inline auto getMinImportedHostPointerAlignment( ) -> vk::DeviceSize
+  {
+    VK_CORE_ASSERT( global::externalMemoryHost, "VK_EXT_external_memory_host is not enabled." );
+
+    auto properties = global::physicalDevice.getProperties2<vk::PhysicalDeviceProperties2, vk::PhysicalDeviceExternalMemoryHostPropertiesEXT>( );
+    return properties.get<vk::PhysicalDeviceExternalMemoryHostPropertiesEXT>( ).minImportedHostPointerAlignment;
+  }
+#endif
+
+  /// Returns the queue family indices of buffers written on the transfer queue family and read on the graphics queue family.
+  ///
+  /// Buffers that are partially updated while in use would need an ownership transfer in both directions for every update. Concurrent sharing avoids this and has no drawbacks for buffers.
+  /// @return Returns both queue family indices if they differ, resulting in concurrent sharing, and an empty vector otherwise.
+  inline auto getSharedQueueFamilyIndices( ) -> std::vector<uint32_t>
+  {
+    if ( global::graphicsFamilyIndex == global::transferFamilyIndex )
+    {
+      return { };
+    }
+
+    return { global::graphicsFamilyIndex, global::transferFamilyIndex };
+  }
+
   inline std::vector<vk::DeviceQueueCreateInfo> getDeviceQueueCreateInfos( )
   {
     std::vector<vk::DeviceQueueCreateInfo> queueCreateInfos;
@@ -547,24 +768,42 @@ namespace vkCore
     return queueCreateInfos;
   }
 
-  inline auto getImageCreateInfo( vk::Extent3D extent ) -> vk::ImageCreateInfo
+  /// Returns the number of mip levels of a full mip chain for the given extent.
+  /// @param extent The extent of the first mip level.
+  /// @return Returns floor( log2( max( width, height, depth ) ) ) + 1.
+  inline auto getMipLevelCount( vk::Extent3D extent ) -> uint32_t
+  {
+    uint32_t size = std::max( { extent.width, extent.height, extent.depth, 1U } );
+    return static_cast<uint32_t>( std::floor( std::log2( size ) ) ) + 1U;
+  }
+
+  /// Returns the create info of a sampled 2D image with an RGBA8 format.
+  /// @param extent The image's extent.
+  /// @param mipLevels The number of mip levels. Images with more than one mip level can also be used as a transfer source to generate their mip chain.
+  inline auto getImageCreateInfo( vk::Extent3D extent, uint32_t mipLevels = 1U ) -> vk::ImageCreateInfo
   {
-    return vk::ImageCreateInfo( { },                                                                     // flags
-                                vk::ImageType::e2D,                                                      // imageType
-                                vk::Format::eR8G8B8A8Unorm,                                              // format
-                                extent,                                                                  // extent
-                                1U,                                                                      // mipLevels
-                                1U,                                                                      // arrayLayers
-                                vk::SampleCountFlagBits::e1,                                             // samples
-                                vk::ImageTiling::eOptimal,                                               // tiling
-                                vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled, // usage
-                                vk::SharingMode::eExclusive,                                             // sharingMode
-                                global::graphicsFamilyIndex,                                             // queueFamilyIndexCount
-                                nullptr,                                                                 // pQueueFamilyIndices
-                                vk::ImageLayout::eUndefined );                                           // initialLayout
+    vk::ImageUsageFlags usage = vk::ImageUsageFlagBits::eTransferDst | vk::ImageUsageFlagBits::eSampled;
+    if ( mipLevels > 1U )
+    {
+      usage |= vk::ImageUsageFlagBits::eTransferSrc;
+    }
+
+    return vk::ImageCreateInfo( { },                           // flags
+                                vk::ImageType::e2D,            // imageType
+                                vk::Format::eR8G8B8A8Unorm,    // format
+                                extent,                        // extent
+                                mipLevels,                     // mipLevels
+                                1U,                            // arrayLayers
+                                vk::SampleCountFlagBits::e1,   // samples
+                                vk::ImageTiling::eOptimal,     // tiling
+                                usage,                         // usage
+                                vk::SharingMode::eExclusive,   // sharingMode
+                                global::graphicsFamilyIndex,   // queueFamilyIndexCount
+                                nullptr,                       // pQueueFamilyIndices
+                                vk::ImageLayout::eUndefined ); // initialLayout
   }
 
-  inline auto getImageViewCreateInfo( vk::Image image, vk::Format format, vk::ImageViewType viewType = vk::ImageViewType::e2D, vk::ImageAspectFlags aspectFlags = vk::ImageAspectFlagBits::eColor ) -> vk::ImageViewCreateInfo
+  inline auto getImageViewCreateInfo( vk::Image image, vk::Format format, vk::ImageViewType viewType = vk::ImageViewType::e2D, vk::ImageAspectFlags aspectFlags = vk::ImageAspectFlagBits::eColor, uint32_t levelCount = 1U ) -> vk::ImageViewCreateInfo
   {
     vk::ComponentMapping components = { vk::ComponentSwizzle::eIdentity,
                                         vk::ComponentSwizzle::eIdentity,
@@ -573,7 +812,7 @@ namespace vkCore
 
     vk::ImageSubresourceRange subresourceRange = { aspectFlags, // aspectMask
                                                    0U,          // baseMipLevel
-                                                   1U,          // levelCount
+                                                   levelCount,  // levelCount
                                                    0U,          // baseArrayLayer
                                                    1U };        // layerCount
 
@@ -600,7 +839,7 @@ namespace vkCore
                                   VK_FALSE,                         // compareEnable
                                   vk::CompareOp::eAlways,           // compareOp
                                   { },                              // minLod
-                                  { },                              // maxLod
+                                  VK_LOD_CLAMP_NONE,                // maxLod
                                   vk::BorderColor::eIntOpaqueBlack, // borderColor
                                   VK_FALSE );                       // unnormalizedCoordinates
   }
@@ -642,6 +881,60 @@ namespace vkCore
     return vk::Format::eUndefined;
   }
 
+  /// Returns the memory accesses and pipeline stages an image is typically used with in the given layout.
+  /// @param layout The image layout.
+  /// @return Returns the access mask and the stage mask.
+  inline auto getLayoutAccessInfo( vk::ImageLayout layout ) -> std::pair<vk::AccessFlags, vk::PipelineStageFlags>
+  {
+    switch ( layout )
+    {
+      case vk::ImageLayout::eUndefined:
+        return { { }, vk::PipelineStageFlagBits::eTopOfPipe };
+
+      case vk::ImageLayout::ePreinitialized:
+        return { vk::AccessFlagBits::eHostWrite, vk::PipelineStageFlagBits::eHost };
+
+      case vk::ImageLayout::eColorAttachmentOptimal:
+        return { vk::AccessFlagBits::eColorAttachmentRead | vk::AccessFlagBits::eColorAttachmentWrite, vk::PipelineStageFlagBits::eColorAttachmentOutput };
+
+      case vk::ImageLayout::eDepthStencilAttachmentOptimal:
+        return { vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eDepthStencilAttachmentWrite, vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eLateFragmentTests };
+
+      case vk::ImageLayout::eDepthStencilReadOnlyOptimal:
+        return { vk::AccessFlagBits::eDepthStencilAttachmentRead | vk::AccessFlagBits::eShaderRead, vk::PipelineStageFlagBits::eEarlyFragmentTests | vk::PipelineStageFlagBits::eFragmentShader };
+
+      case vk::ImageLayout::eShaderReadOnlyOptimal:
+        return { vk::AccessFlagBits::eShaderRead, vk::PipelineStageFlagBits::eVertexShader | vk::PipelineStageFlagBits::eFragmentShader | vk::PipelineStageFlagBits::eComputeShader };
+
+      case vk::ImageLayout::eTransferSrcOptimal:
+        return { vk::AccessFlagBits::eTransferRead, vk::PipelineStageFlagBits::eTransfer };
+
+      case vk::ImageLayout::eTransferDstOptimal:
+        return { vk::AccessFlagBits::eTransferWrite, vk::PipelineStageFlagBits::eTransfer };
+
+      case vk::ImageLayout::ePresentSrcKHR:
+        return { { }, vk::PipelineStageFlagBits::eBottomOfPipe };
+
+      default:
+        // eGeneral and all remaining layouts may be used by anything.
+        return { vk::AccessFlagBits::eMemoryRead | vk::AccessFlagBits::eMemoryWrite, vk::PipelineStageFlagBits::eAllCommands };
+    }
+  }
+
+  /// Filters the write accesses of an access mask. Only writes have to be made available by a barrier.
+  /// @param access The access mask.
+  /// @return Returns the access mask without read accesses.
+  inline auto getWriteAccess( vk::AccessFlags access ) -> vk::AccessFlags
+  {
+    return access & ( vk::AccessFlagBits::eShaderWrite |
+                      vk::AccessFlagBits::eColorAttachmentWrite |
+                      vk::AccessFlagBits::eDepthStencilAttachmentWrite |
+                      vk::AccessFlagBits::eTransferWrite |
+                      vk::AccessFlagBits::eHostWrite |
+                      vk::AccessFlagBits::eMemoryWrite |
+                      vk::AccessFlagBits::eAccelerationStructureWriteKHR );
+  }
+
   /// Simplifies the process of setting up an image memory barrier info.
   /// @param image The vulkan image.
   /// @param oldLayout The current image layout of the given vulkan image.
@@ -671,77 +964,633 @@ namespace vkCore
       barrier.subresourceRange = *subresourceRange;
     }
 
-    vk::PipelineStageFlags srcStageMask = vk::PipelineStageFlagBits::eAllCommands;
-    vk::PipelineStageFlags dstStageMask = vk::PipelineStageFlagBits::eAllCommands;
+    // Derive the barrier from the accesses and stages that are typical for both layouts.
+    auto src = getLayoutAccessInfo( oldLayout );
+    auto dst = getLayoutAccessInfo( newLayout );
 
-    if ( oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::eTransferDstOptimal )
-    {
-      barrier.srcAccessMask = { };
-      barrier.dstAccessMask = vk::AccessFlagBits::eTransferWrite;
+    barrier.srcAccessMask = getWriteAccess( src.first );
+    barrier.dstAccessMask = dst.first;
 
-      srcStageMask = vk::PipelineStageFlagBits::eTopOfPipe;
-      dstStageMask = vk::PipelineStageFlagBits::eTransfer;
-    }
-    else if ( oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::eDepthStencilAttachmentOptimal )
-    {
-      barrier.srcAccessMask = { };
-      barrier.dstAccessMask = vk::AccessFlagBits::eDepthStencilAttachmentWrite;
+    // Layouts without accesses, e.g. of new or presented images, wait for the destination stages instead.
+    // This chains the transition to semaphore waits at these stages, e.g. for the acquisition of a swapchain image.
+    vk::PipelineStageFlags srcStageMask = src.first ? src.second : dst.second;
+    vk::PipelineStageFlags dstStageMask = dst.second;
 
-      srcStageMask = vk::PipelineStageFlagBits::eTopOfPipe;
-      dstStageMask = vk::PipelineStageFlagBits::eEarlyFragmentTests;
-    }
-    else if ( oldLayout == vk::ImageLayout::eTransferDstOptimal && newLayout == vk::ImageLayout::eShaderReadOnlyOptimal )
+    return { barrier, srcStageMask, dstStageMask };
+  }
+
+  /// The transfer commands a barrier synchronizes with in vk::PipelineStageFlagBits::eTransfer.
+  ///
+  /// If VK_KHR_synchronization2 is enabled, the transfer stage is narrowed down to the stages of these commands. Otherwise, they are ignored.
+  namespace TransferCommandBits
+  {
+    inline constexpr uint32_t eCopy    = 1U << 0U;                          ///< vkCmdCopy* commands.
+    inline constexpr uint32_t eBlit    = 1U << 1U;                          ///< vkCmdBlitImage.
+    inline constexpr uint32_t eClear   = 1U << 2U;                          ///< vkCmdClear*Image, vkCmdFillBuffer and vkCmdUpdateBuffer.
+    inline constexpr uint32_t eResolve = 1U << 3U;                          ///< vkCmdResolveImage.
+    inline constexpr uint32_t eAll     = eCopy | eBlit | eClear | eResolve; ///< Any transfer command.
+  } // namespace TransferCommandBits
+
+  using TransferCommandFlags = uint32_t;
+
+#ifdef VK_KHR_synchronization2
+  /// Converts legacy pipeline stages to their synchronization2 counterparts.
+  /// @param stages The legacy stage mask.
+  /// @param transferCommands The transfer commands vk::PipelineStageFlagBits::eTransfer refers to.
+  /// @return Returns the synchronization2 stage mask.
+  inline auto getPipelineStageFlags2( vk::PipelineStageFlags stages, TransferCommandFlags transferCommands = TransferCommandBits::eAll ) -> vk::PipelineStageFlags2KHR
+  {
+    // The legacy bits are identical to the lower bits of the synchronization2 bits.
+    auto stages2 = vk::PipelineStageFlags2KHR( static_cast<VkPipelineStageFlags2KHR>( static_cast<VkPipelineStageFlags>( stages ) ) );
+
+    if ( ( stages & vk::PipelineStageFlagBits::eTransfer ) && transferCommands != TransferCommandBits::eAll )
     {
-      barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
-      barrier.dstAccessMask = vk::AccessFlagBits::eShaderRead;
+      stages2 &= ~vk::PipelineStageFlags2KHR( vk::PipelineStageFlagBits2KHR::eAllTransfer );
+
+      if ( transferCommands & TransferCommandBits::eCopy )
+      {
+        stages2 |= vk::PipelineStageFlagBits2KHR::eCopy;
+      }
 
-      srcStageMask = vk::PipelineStageFlagBits::eTransfer;
-      dstStageMask = vk::PipelineStageFlagBits::eFragmentShader;
+      if ( transferCommands & TransferCommandBits::eBlit )
+      {
+        stages2 |= vk::PipelineStageFlagBits2KHR::eBlit;
+      }
+
+      if ( transferCommands & TransferCommandBits::eClear )
+      {
+        stages2 |= vk::PipelineStageFlagBits2KHR::eClear;
+      }
+
+      if ( transferCommands & TransferCommandBits::eResolve )
+      {
+        stages2 |= vk::PipelineStageFlagBits2KHR::eResolve;
+      }
     }
-    else if ( oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::eGeneral )
+
+    return stages2;
+  }
+
+  /// Converts legacy access flags to their synchronization2 counterparts.
+  /// @param access The legacy access mask.
+  /// @return Returns the synchronization2 access mask.
+  inline auto getAccessFlags2( vk::AccessFlags access ) -> vk::AccessFlags2KHR
+  {
+    return vk::AccessFlags2KHR( static_cast<VkAccessFlags2KHR>( static_cast<VkAccessFlags>( access ) ) );
+  }
+
+  /// Converts a legacy image memory barrier to a synchronization2 barrier that carries its own stage masks.
+  ///
+  /// Shader reads of images in eShaderReadOnlyOptimal are narrowed down to sampled reads.
+  /// @param barrier The legacy barrier.
+  /// @param srcStageMask The stages the barrier waits for.
+  /// @param dstStageMask The stages waiting for the barrier.
+  /// @param srcTransferCommands The transfer commands the barrier waits for.
+  /// @param dstTransferCommands The transfer commands waiting for the barrier.
+  /// @return Returns the synchronization2 barrier.
+  inline auto getImageMemoryBarrier2( const vk::ImageMemoryBarrier& barrier, vk::PipelineStageFlags srcStageMask, vk::PipelineStageFlags dstStageMask, TransferCommandFlags srcTransferCommands = TransferCommandBits::eAll, TransferCommandFlags dstTransferCommands = TransferCommandBits::eAll ) -> vk::ImageMemoryBarrier2KHR
+  {
+    vk::AccessFlags2KHR dstAccessMask = getAccessFlags2( barrier.dstAccessMask );
+    if ( barrier.newLayout == vk::ImageLayout::eShaderReadOnlyOptimal && ( dstAccessMask & vk::AccessFlagBits2KHR::eShaderRead ) )
     {
-      // nothing to do.
+      dstAccessMask &= ~vk::AccessFlags2KHR( vk::AccessFlagBits2KHR::eShaderRead );
+      dstAccessMask |= vk::AccessFlagBits2KHR::eShaderSampledRead;
     }
-    else if ( oldLayout == vk::ImageLayout::eGeneral && newLayout == vk::ImageLayout::eTransferSrcOptimal )
+
+    return vk::ImageMemoryBarrier2KHR( getPipelineStageFlags2( srcStageMask, srcTransferCommands ), // srcStageMask
+                                       getAccessFlags2( barrier.srcAccessMask ),                    // srcAccessMask
+                                       getPipelineStageFlags2( dstStageMask, dstTransferCommands ), // dstStageMask
+                                       dstAccessMask,                                               // dstAccessMask
+                                       barrier.oldLayout,                                           // oldLayout
+                                       barrier.newLayout,                                           // newLayout
+                                       barrier.srcQueueFamilyIndex,                                 // srcQueueFamilyIndex
+                                       barrier.dstQueueFamilyIndex,                                 // dstQueueFamilyIndex
+                                       barrier.image,                                               // image
+                                       barrier.subresourceRange );                                  // subresourceRange
+  }
+
+  /// Converts a legacy buffer memory barrier to a synchronization2 barrier that carries its own stage masks.
+  /// @param barrier The legacy barrier.
+  /// @param srcStageMask The stages the barrier waits for.
+  /// @param dstStageMask The stages waiting for the barrier.
+  /// @param srcTransferCommands The transfer commands the barrier waits for.
+  /// @param dstTransferCommands The transfer commands waiting for the barrier.
+  /// @return Returns the synchronization2 barrier.
+  inline auto getBufferMemoryBarrier2( const vk::BufferMemoryBarrier& barrier, vk::PipelineStageFlags srcStageMask, vk::PipelineStageFlags dstStageMask, TransferCommandFlags srcTransferCommands = TransferCommandBits::eAll, TransferCommandFlags dstTransferCommands = TransferCommandBits::eAll ) -> vk::BufferMemoryBarrier2KHR
+  {
+    return vk::BufferMemoryBarrier2KHR( getPipelineStageFlags2( srcStageMask, srcTransferCommands ), // srcStageMask
+                                        getAccessFlags2( barrier.srcAccessMask ),                    // srcAccessMask
+                                        getPipelineStageFlags2( dstStageMask, dstTransferCommands ), // dstStageMask
+                                        getAccessFlags2( barrier.dstAccessMask ),                    // dstAccessMask
+                                        barrier.srcQueueFamilyIndex,                                 // srcQueueFamilyIndex
+                                        barrier.dstQueueFamilyIndex,                                 // dstQueueFamilyIndex
+                                        barrier.buffer,                                              // buffer
+                                        barrier.offset,                                              // offset
+                                        barrier.size );                                              // size
+  }
+#endif
+
+  /// Records an image memory barrier as returned by getImageMemoryBarrierInfo().
+  ///
+  /// If VK_KHR_synchronization2 is enabled, the barrier is recorded using vkCmdPipelineBarrier2KHR.
+  /// @param commandBuffer The command buffer to record to. It must be in the recording state.
+  /// @param barrierInfo The barrier and its source and destination stage masks.
+  /// @param srcTransferCommands The transfer commands the barrier waits for.
+  /// @param dstTransferCommands The transfer commands waiting for the barrier.
+  inline void recordImageMemoryBarrier( vk::CommandBuffer commandBuffer, const std::tuple<vk::ImageMemoryBarrier, vk::PipelineStageFlags, vk::PipelineStageFlags>& barrierInfo, TransferCommandFlags srcTransferCommands = TransferCommandBits::eAll, TransferCommandFlags dstTransferCommands = TransferCommandBits::eAll )
+  {
+#ifdef VK_KHR_synchronization2
+    if ( global::synchronization2 )
     {
-      barrier.dstAccessMask = vk::AccessFlagBits::eTransferRead;
+      vk::ImageMemoryBarrier2KHR barrier = getImageMemoryBarrier2( std::get<0>( barrierInfo ), std::get<1>( barrierInfo ), std::get<2>( barrierInfo ), srcTransferCommands, dstTransferCommands );
+
+      vk::DependencyInfoKHR dependencyInfo;
+      dependencyInfo.dependencyFlags         = vk::DependencyFlagBits::eByRegion;
+      dependencyInfo.imageMemoryBarrierCount = 1;
+      dependencyInfo.pImageMemoryBarriers    = &barrier;
+
+      commandBuffer.pipelineBarrier2KHR( dependencyInfo ); // CMD
+      return;
     }
-    else if ( oldLayout == vk::ImageLayout::eTransferSrcOptimal && newLayout == vk::ImageLayout::eGeneral )
+#endif
+
+    commandBuffer.pipelineBarrier( std::get<1>( barrierInfo ), // srcStageMask
+                                   std::get<2>( barrierInfo ), // dstStageMask
+                                   vk::DependencyFlagBits::eByRegion,
+                                   0,
+                                   nullptr,
+                                   0,
+                                   nullptr,
+                                   1,
+                                   &std::get<0>( barrierInfo ) ); // barrier
+  }
+
+  /// Records a single global memory barrier.
+  ///
+  /// If VK_KHR_synchronization2 is enabled, the barrier is recorded using vkCmdPipelineBarrier2KHR.
+  /// @param commandBuffer The command buffer to record to. It must be in the recording state.
+  /// @param srcAccessMask The accesses to make available.
+  /// @param dstAccessMask The accesses to make the memory visible to.
+  /// @param srcStageMask The barrier's source stage mask.
+  /// @param dstStageMask The barrier's destination stage mask.
+  /// @param srcTransferCommands The transfer commands the barrier waits for.
+  /// @param dstTransferCommands The transfer commands waiting for the barrier.
+  inline void recordMemoryBarrier( vk::CommandBuffer commandBuffer, vk::AccessFlags srcAccessMask, vk::AccessFlags dstAccessMask, vk::PipelineStageFlags srcStageMask, vk::PipelineStageFlags dstStageMask, TransferCommandFlags srcTransferCommands = TransferCommandBits::eAll, TransferCommandFlags dstTransferCommands = TransferCommandBits::eAll )
+  {
+#ifdef VK_KHR_synchronization2
+    if ( global::synchronization2 )
     {
-      barrier.srcAccessMask = vk::AccessFlagBits::eTransferRead;
+      vk::MemoryBarrier2KHR barrier( getPipelineStageFlags2( srcStageMask, srcTransferCommands ), // srcStageMask
+                                     getAccessFlags2( srcAccessMask ),                            // srcAccessMask
+                                     getPipelineStageFlags2( dstStageMask, dstTransferCommands ), // dstStageMask
+                                     getAccessFlags2( dstAccessMask ) );                          // dstAccessMask
+
+      vk::DependencyInfoKHR dependencyInfo;
+      dependencyInfo.memoryBarrierCount = 1;
+      dependencyInfo.pMemoryBarriers    = &barrier;
+
+      commandBuffer.pipelineBarrier2KHR( dependencyInfo ); // CMD
+      return;
     }
-    else if ( oldLayout == vk::ImageLayout::eTransferDstOptimal && newLayout == vk::ImageLayout::ePresentSrcKHR )
+#endif
+
+    vk::MemoryBarrier barrier( srcAccessMask,   // srcAccessMask
+                               dstAccessMask ); // dstAccessMask
+
+    commandBuffer.pipelineBarrier( srcStageMask, // srcStageMask
+                                   dstStageMask, // dstStageMask
+                                   { },          // dependencyFlags
+                                   1,            // memoryBarrierCount
+                                   &barrier,     // pMemoryBarriers
+                                   0,            // bufferMemoryBarrierCount
+                                   nullptr,      // pBufferMemoryBarriers
+                                   0,            // imageMemoryBarrierCount
+                                   nullptr );    // pImageMemoryBarriers
+  }
+
+  /// Records a single buffer memory barrier.
+  ///
+  /// If VK_KHR_synchronization2 is enabled, the barrier is recorded using vkCmdPipelineBarrier2KHR.
+  /// @param commandBuffer The command buffer to record to. It must be in the recording state.
+  /// @param barrier The barrier.
+  /// @param srcStageMask The barrier's source stage mask.
+  /// @param dstStageMask The barrier's destination stage mask.
+  /// @param srcTransferCommands The transfer commands the barrier waits for.
+  /// @param dstTransferCommands The transfer commands waiting for the barrier.
+  inline void recordBufferMemoryBarrier( vk::CommandBuffer commandBuffer, const vk::BufferMemoryBarrier& barrier, vk::PipelineStageFlags srcStageMask, vk::PipelineStageFlags dstStageMask, TransferCommandFlags srcTransferCommands = TransferCommandBits::eAll, TransferCommandFlags dstTransferCommands = TransferCommandBits::eAll )
+  {
+#ifdef VK_KHR_synchronization2
+    if ( global::synchronization2 )
     {
-      barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
+      vk::BufferMemoryBarrier2KHR barrier2 = getBufferMemoryBarrier2( barrier, srcStageMask, dstStageMask, srcTransferCommands, dstTransferCommands );
+
+      vk::DependencyInfoKHR dependencyInfo;
+      dependencyInfo.bufferMemoryBarrierCount = 1;
+      dependencyInfo.pBufferMemoryBarriers    = &barrier2;
+
+      commandBuffer.pipelineBarrier2KHR( dependencyInfo ); // CMD
+      return;
     }
-    else if ( oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::ePresentSrcKHR )
+#endif
+
+    commandBuffer.pipelineBarrier( srcStageMask, // srcStageMask
+                                   dstStageMask, // dstStageMask
+                                   { },          // dependencyFlags
+                                   0,            // memoryBarrierCount
+                                   nullptr,      // pMemoryBarriers
+                                   1,            // bufferMemoryBarrierCount
+                                   &barrier,     // pBufferMemoryBarriers
+                                   0,            // imageMemoryBarrierCount
+                                   nullptr );    // pImageMemoryBarriers
+  }
+
+  /// Describes a single image layout transition for transitionImageLayouts().
+  struct ImageTransition
+  {
+    vk::Image image           = nullptr;                       ///< The image to transition.
+    vk::ImageLayout oldLayout = vk::ImageLayout::eUndefined;   ///< The image's current layout.
+    vk::ImageLayout newLayout = vk::ImageLayout::eUndefined;   ///< The target layout.
+    std::optional<vk::ImageSubresourceRange> subresourceRange; ///< Optionally used to define a non-standard subresource range.
+  };
+
+  /// Records multiple image layout transitions using a single pipeline barrier.
+  ///
+  /// If VK_KHR_synchronization2 is enabled, every barrier keeps its own stage masks. Otherwise, the barrier uses the union of all stage masks.
+  /// @param transitions The transitions to record.
+  /// @param commandBuffer The command buffer that will be used. It must be in the recording stage.
+  inline void transitionImageLayouts( const std::vector<ImageTransition>& transitions, vk::CommandBuffer commandBuffer )
+  {
+    if ( transitions.empty( ) )
     {
-      barrier.srcAccessMask = { };
+      return;
     }
-    else if ( oldLayout == vk::ImageLayout::ePresentSrcKHR && newLayout == vk::ImageLayout::eColorAttachmentOptimal )
+
+    std::vector<vk::ImageMemoryBarrier> barriers;
+    barriers.reserve( transitions.size( ) );
+
+#ifdef VK_KHR_synchronization2
+    std::vector<vk::ImageMemoryBarrier2KHR> barriers2;
+    barriers2.reserve( transitions.size( ) );
+#endif
+
+    vk::PipelineStageFlags srcStageMask;
+    vk::PipelineStageFlags dstStageMask;
+
+    for ( const ImageTransition& transition : transitions )
     {
-      barrier.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+      auto barrierInfo = getImageMemoryBarrierInfo( transition.image, transition.oldLayout, transition.newLayout, transition.subresourceRange.has_value( ) ? &transition.subresourceRange.value( ) : nullptr );
+
+      barriers.push_back( std::get<0>( barrierInfo ) );
+      srcStageMask |= std::get<1>( barrierInfo );
+      dstStageMask |= std::get<2>( barrierInfo );
+
+#ifdef VK_KHR_synchronization2
+      barriers2.push_back( getImageMemoryBarrier2( std::get<0>( barrierInfo ), std::get<1>( barrierInfo ), std::get<2>( barrierInfo ) ) );
+#endif
     }
-    else if ( oldLayout == vk::ImageLayout::eColorAttachmentOptimal && newLayout == vk::ImageLayout::ePresentSrcKHR )
+
+#ifdef VK_KHR_synchronization2
+    if ( global::synchronization2 )
     {
-      barrier.srcAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+      vk::DependencyInfoKHR dependencyInfo;
+      dependencyInfo.dependencyFlags         = vk::DependencyFlagBits::eByRegion;
+      dependencyInfo.imageMemoryBarrierCount = static_cast<uint32_t>( barriers2.size( ) );
+      dependencyInfo.pImageMemoryBarriers    = barriers2.data( );
+
+      commandBuffer.pipelineBarrier2KHR( dependencyInfo ); // CMD
+      return;
     }
-    else if ( oldLayout == vk::ImageLayout::eUndefined && newLayout == vk::ImageLayout::eColorAttachmentOptimal )
+#endif
+
+    commandBuffer.pipelineBarrier( srcStageMask, // srcStageMask
+                                   dstStageMask, // dstStageMask
+                                   vk::DependencyFlagBits::eByRegion,
+                                   0,
+                                   nullptr,
+                                   0,
+                                   nullptr,
+                                   static_cast<uint32_t>( barriers.size( ) ),
+                                   barriers.data( ) ); // barriers
+  }
+
+  /// Submits a single command buffer to a queue.
+  ///
+  /// If VK_KHR_synchronization2 is enabled, vkQueueSubmit2KHR is used.
+  /// @param queue The queue to submit to.
+  /// @param commandBuffer The command buffer to submit.
+  /// @param fence A fence that is signaled once the command buffer has finished executing.
+  /// @param waitSemaphores Binary semaphores the submission waits on.
+  /// @param waitStages The stages at which each of the wait semaphores is waited on.
+  /// @param signalSemaphores Binary semaphores that are signaled once the command buffer has finished executing.
+  inline void submitCommandBuffer( vk::Queue queue, vk::CommandBuffer commandBuffer, vk::Fence fence = nullptr, const std::vector<vk::Semaphore>& waitSemaphores = { }, const std::vector<vk::PipelineStageFlags>& waitStages = { }, const std::vector<vk::Semaphore>& signalSemaphores = { } )
+  {
+    VK_CORE_ASSERT( ( waitSemaphores.size( ) == waitStages.size( ) ), "Every wait semaphore requires a wait stage mask." );
+
+#ifdef VK_KHR_synchronization2
+    if ( global::synchronization2 )
     {
-      barrier.srcAccessMask = { };
-      barrier.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+      vk::CommandBufferSubmitInfoKHR commandBufferInfo( commandBuffer ); // commandBuffer
+
+      std::vector<vk::SemaphoreSubmitInfoKHR> waitSemaphoreInfos;
+      waitSemaphoreInfos.reserve( waitSemaphores.size( ) );
+
+      for ( size_t i = 0; i < waitSemaphores.size( ); ++i )
+      {
+        waitSemaphoreInfos.emplace_back( waitSemaphores[i], 0, getPipelineStageFlags2( waitStages[i] ) );
+      }
+
+      std::vector<vk::SemaphoreSubmitInfoKHR> signalSemaphoreInfos;
+      signalSemaphoreInfos.reserve( signalSemaphores.size( ) );
+
+      for ( vk::Semaphore semaphore : signalSemaphores )
+      {
+        signalSemaphoreInfos.emplace_back( semaphore, 0, vk::PipelineStageFlagBits2KHR::eAllCommands );
+      }
+
+      vk::SubmitInfo2KHR submitInfo;
+      submitInfo.waitSemaphoreInfoCount   = static_cast<uint32_t>( waitSemaphoreInfos.size( ) );
+      submitInfo.pWaitSemaphoreInfos      = waitSemaphoreInfos.data( );
+      submitInfo.commandBufferInfoCount   = 1;
+      submitInfo.pCommandBufferInfos      = &commandBufferInfo;
+      submitInfo.signalSemaphoreInfoCount = static_cast<uint32_t>( signalSemaphoreInfos.size( ) );
+      submitInfo.pSignalSemaphoreInfos    = signalSemaphoreInfos.data( );
+
+      if ( queue.submit2KHR( 1, &submitInfo, fence ) != vk::Result::eSuccess )
+      {
+        VK_CORE_THROW( "Failed to submit" );
+      }
+
+      return;
     }
-    else if ( oldLayout == vk::ImageLayout::eTransferDstOptimal && newLayout == vk::ImageLayout::eColorAttachmentOptimal )
+#endif
+
+    vk::SubmitInfo submitInfo( static_cast<uint32_t>( waitSemaphores.size( ) ),   // waitSemaphoreCount
+                               waitSemaphores.data( ),                             // pWaitSemaphores
+                               waitStages.data( ),                                 // pWaitDstStageMask
+                               1,                                                  // commandBufferCount
+                               &commandBuffer,                                     // pCommandBuffers
+                               static_cast<uint32_t>( signalSemaphores.size( ) ), // signalSemaphoreCount
+                               signalSemaphores.data( ) );                         // pSignalSemaphores
+
+    if ( queue.submit( 1, &submitInfo, fence ) != vk::Result::eSuccess )
     {
-      barrier.srcAccessMask = vk::AccessFlagBits::eTransferWrite;
-      barrier.dstAccessMask = vk::AccessFlagBits::eColorAttachmentWrite;
+      VK_CORE_THROW( "Failed to submit" );
     }
-    else
+  }
+
+  /// Returns the aspects of an image with the given format.
+  /// @param format The image's format.
+  /// @return Returns the depth and/or stencil aspect for depth/stencil formats and the color aspect otherwise.
+  inline auto getImageAspectFlags( vk::Format format ) -> vk::ImageAspectFlags
+  {
+    switch ( format )
     {
-      VK_CORE_THROW( "Image layout transition not supported." );
+      case vk::Format::eD16Unorm:
+      case vk::Format::eX8D24UnormPack32:
+      case vk::Format::eD32Sfloat:
+        return vk::ImageAspectFlagBits::eDepth;
+
+      case vk::Format::eD16UnormS8Uint:
+      case vk::Format::eD24UnormS8Uint:
+      case vk::Format::eD32SfloatS8Uint:
+        return vk::ImageAspectFlagBits::eDepth | vk::ImageAspectFlagBits::eStencil;
+
+      case vk::Format::eS8Uint:
+        return vk::ImageAspectFlagBits::eStencil;
+
+      default:
+        return vk::ImageAspectFlagBits::eColor;
     }
+  }
 
-    return { barrier, srcStageMask, dstStageMask };
+  /// Returns the size and extent of a texel block of the given format, e.g. 4x4 texels for block-compressed formats.
+  /// @param format The format. Multi-planar and depth/stencil formats are not supported.
+  /// @return Returns the size of a texel block in bytes and its extent in texels, or a size of 0 if the format is not supported.
+  inline auto getTexelBlockInfo( vk::Format format ) -> std::pair<vk::DeviceSize, vk::Extent2D>
+  {
+    switch ( format )
+    {
+      case vk::Format::eR8Unorm:
+      case vk::Format::eR8Snorm:
+      case vk::Format::eR8Uscaled:
+      case vk::Format::eR8Sscaled:
+      case vk::Format::eR8Uint:
+      case vk::Format::eR8Sint:
+      case vk::Format::eR8Srgb:
+        return { 1, { 1, 1 } };
+
+      case vk::Format::eR8G8Unorm:
+      case vk::Format::eR8G8Snorm:
+      case vk::Format::eR8G8Uscaled:
+      case vk::Format::eR8G8Sscaled:
+      case vk::Format::eR8G8Uint:
+      case vk::Format::eR8G8Sint:
+      case vk::Format::eR8G8Srgb:
+      case vk::Format::eR16Unorm:
+      case vk::Format::eR16Snorm:
+      case vk::Format::eR16Uscaled:
+      case vk::Format::eR16Sscaled:
+      case vk::Format::eR16Uint:
+      case vk::Format::eR16Sint:
+      case vk::Format::eR16Sfloat:
+      case vk::Format::eR4G4B4A4UnormPack16:
+      case vk::Format::eB4G4R4A4UnormPack16:
+      case vk::Format::eR5G6B5UnormPack16:
+      case vk::Format::eB5G6R5UnormPack16:
+      case vk::Format::eR5G5B5A1UnormPack16:
+      case vk::Format::eB5G5R5A1UnormPack16:
+      case vk::Format::eA1R5G5B5UnormPack16:
+        return { 2, { 1, 1 } };
+
+      case vk::Format::eR8G8B8Unorm:
+      case vk::Format::eR8G8B8Snorm:
+      case vk::Format::eR8G8B8Uscaled:
+      case vk::Format::eR8G8B8Sscaled:
+      case vk::Format::eR8G8B8Uint:
+      case vk::Format::eR8G8B8Sint:
+      case vk::Format::eR8G8B8Srgb:
+      case vk::Format::eB8G8R8Unorm:
+      case vk::Format::eB8G8R8Snorm:
+      case vk::Format::eB8G8R8Uscaled:
+      case vk::Format::eB8G8R8Sscaled:
+      case vk::Format::eB8G8R8Uint:
+      case vk::Format::eB8G8R8Sint:
+      case vk::Format::eB8G8R8Srgb:
+        return { 3, { 1, 1 } };
+
+      case vk::Format::eR8G8B8A8Unorm:
+      case vk::Format::eR8G8B8A8Snorm:
+      case vk::Format::eR8G8B8A8Uscaled:
+      case vk::Format::eR8G8B8A8Sscaled:
+      case vk::Format::eR8G8B8A8Uint:
+      case vk::Format::eR8G8B8A8Sint:
+      case vk::Format::eR8G8B8A8Srgb:
+      case vk::Format::eB8G8R8A8Unorm:
+      case vk::Format::eB8G8R8A8Snorm:
+      case vk::Format::eB8G8R8A8Uscaled:
+      case vk::Format::eB8G8R8A8Sscaled:
+      case vk::Format::eB8G8R8A8Uint:
+      case vk::Format::eB8G8R8A8Sint:
+      case vk::Format::eB8G8R8A8Srgb:
+      case vk::Format::eA8B8G8R8UnormPack32:
+      case vk::Format::eA8B8G8R8SnormPack32:
+      case vk::Format::eA8B8G8R8UscaledPack32:
+      case vk::Format::eA8B8G8R8SscaledPack32:
+      case vk::Format::eA8B8G8R8UintPack32:
+      case vk::Format::eA8B8G8R8SintPack32:
+      case vk::Format::eA8B8G8R8SrgbPack32:
+      case vk::Format::eA2R10G10B10UnormPack32:
+      case vk::Format::eA2R10G10B10SnormPack32:
+      case vk::Format::eA2R10G10B10UscaledPack32:
+      case vk::Format::eA2R10G10B10SscaledPack32:
+      case vk::Format::eA2R10G10B10UintPack32:
+      case vk::Format::eA2R10G10B10SintPack32:
+      case vk::Format::eA2B10G10R10UnormPack32:
+      case vk::Format::eA2B10G10R10SnormPack32:
+      case vk::Format::eA2B10G10R10UscaledPack32:
+      case vk::Format::eA2B10G10R10SscaledPack32:
+      case vk::Format::eA2B10G10R10UintPack32:
+      case vk::Format::eA2B10G10R10SintPack32:
+      case vk::Format::eR16G16Unorm:
+      case vk::Format::eR16G16Snorm:
+      case vk::Format::eR16G16Uscaled:
+      case vk::Format::eR16G16Sscaled:
+      case vk::Format::eR16G16Uint:
+      case vk::Format::eR16G16Sint:
+      case vk::Format::eR16G16Sfloat:
+      case vk::Format::eR32Uint:
+      case vk::Format::eR32Sint:
+      case vk::Format::eR32Sfloat:
+      case vk::Format::eB10G11R11UfloatPack32:
+      case vk::Format::eE5B9G9R9UfloatPack32:
+        return { 4, { 1, 1 } };
+
+      case vk::Format::eR16G16B16Unorm:
+      case vk::Format::eR16G16B16Snorm:
+      case vk::Format::eR16G16B16Uscaled:
+      case vk::Format::eR16G16B16Sscaled:
+      case vk::Format::eR16G16B16Uint:
+      case vk::Format::eR16G16B16Sint:
+      case vk::Format::eR16G16B16Sfloat:
+        return { 6, { 1, 1 } };
+
+      case vk::Format::eR16G16B16A16Unorm:
+      case vk::Format::eR16G16B16A16Snorm:
+      case vk::Format::eR16G16B16A16Uscaled:
+      case vk::Format::eR16G16B16A16Sscaled:
+      case vk::Format::eR16G16B16A16Uint:
+      case vk::Format::eR16G16B16A16Sint:
+      case vk::Format::eR16G16B16A16Sfloat:
+      case vk::Format::eR32G32Uint:
+      case vk::Format::eR32G32Sint:
+      case vk::Format::eR32G32Sfloat:
+      case vk::Format::eR64Uint:
+      case vk::Format::eR64Sint:
+      case vk::Format::eR64Sfloat:
+        return { 8, { 1, 1 } };
+
+      case vk::Format::eR32G32B32Uint:
+      case vk::Format::eR32G32B32Sint:
+      case vk::Format::eR32G32B32Sfloat:
+        return { 12, { 1, 1 } };
+
+      case vk::Format::eR32G32B32A32Uint:
+      case vk::Format::eR32G32B32A32Sint:
+      case vk::Format::eR32G32B32A32Sfloat:
+      case vk::Format::eR64G64Uint:
+      case vk::Format::eR64G64Sint:
+      case vk::Format::eR64G64Sfloat:
+        return { 16, { 1, 1 } };
+
+      case vk::Format::eBc1RgbUnormBlock:
+      case vk::Format::eBc1RgbSrgbBlock:
+      case vk::Format::eBc1RgbaUnormBlock:
+      case vk::Format::eBc1RgbaSrgbBlock:
+      case vk::Format::eBc4UnormBlock:
+      case vk::Format::eBc4SnormBlock:
+      case vk::Format::eEtc2R8G8B8UnormBlock:
+      case vk::Format::eEtc2R8G8B8SrgbBlock:
+      case vk::Format::eEtc2R8G8B8A1UnormBlock:
+      case vk::Format::eEtc2R8G8B8A1SrgbBlock:
+      case vk::Format::eEacR11UnormBlock:
+      case vk::Format::eEacR11SnormBlock:
+        return { 8, { 4, 4 } };
+
+      case vk::Format::eBc2UnormBlock:
+      case vk::Format::eBc2SrgbBlock:
+      case vk::Format::eBc3UnormBlock:
+      case vk::Format::eBc3SrgbBlock:
+      case vk::Format::eBc5UnormBlock:
+      case vk::Format::eBc5SnormBlock:
+      case vk::Format::eBc6HUfloatBlock:
+      case vk::Format::eBc6HSfloatBlock:
+      case vk::Format::eBc7UnormBlock:
+      case vk::Format::eBc7SrgbBlock:
+      case vk::Format::eEtc2R8G8B8A8UnormBlock:
+      case vk::Format::eEtc2R8G8B8A8SrgbBlock:
+      case vk::Format::eEacR11G11UnormBlock:
+      case vk::Format::eEacR11G11SnormBlock:
+        return { 16, { 4, 4 } };
+
+      case vk::Format::eAstc4x4UnormBlock:
+      case vk::Format::eAstc4x4SrgbBlock:
+        return { 16, { 4, 4 } };
+
+      case vk::Format::eAstc5x4UnormBlock:
+      case vk::Format::eAstc5x4SrgbBlock:
+        return { 16, { 5, 4 } };
+
+      case vk::Format::eAstc5x5UnormBlock:
+      case vk::Format::eAstc5x5SrgbBlock:
+        return { 16, { 5, 5 } };
+
+      case vk::Format::eAstc6x5UnormBlock:
+      case vk::Format::eAstc6x5SrgbBlock:
+        return { 16, { 6, 5 } };
+
+      case vk::Format::eAstc6x6UnormBlock:
+      case vk::Format::eAstc6x6SrgbBlock:
+        return { 16, { 6, 6 } };
+
+      case vk::Format::eAstc8x5UnormBlock:
+      case vk::Format::eAstc8x5SrgbBlock:
+        return { 16, { 8, 5 } };
+
+      case vk::Format::eAstc8x6UnormBlock:
+      case vk::Format::eAstc8x6SrgbBlock:
+        return { 16, { 8, 6 } };
+
+      case vk::Format::eAstc8x8UnormBlock:
+      case vk::Format::eAstc8x8SrgbBlock:
+        return { 16, { 8, 8 } };
+
+      case vk::Format::eAstc10x5UnormBlock:
+      case vk::Format::eAstc10x5SrgbBlock:
+        return { 16, { 10, 5 } };
+
+      case vk::Format::eAstc10x6UnormBlock:
+      case vk::Format::eAstc10x6SrgbBlock:
+        return { 16, { 10, 6 } };
+
+      case vk::Format::eAstc10x8UnormBlock:
+      case vk::Format::eAstc10x8SrgbBlock:
+        return { 16, { 10, 8 } };
+
+      case vk::Format::eAstc10x10UnormBlock:
+      case vk::Format::eAstc10x10SrgbBlock:
+        return { 16, { 10, 10 } };
+
+      case vk::Format::eAstc12x10UnormBlock:
+      case vk::Format::eAstc12x10SrgbBlock:
+        return { 16, { 12, 10 } };
+
+      case vk::Format::eAstc12x12UnormBlock:
+      case vk::Format::eAstc12x12SrgbBlock:
+        return { 16, { 12, 12 } };
+
+      default:
+        return { 0, { } };
+    }
   }
 
   /// Retrieves the depth format supported by a given physical device.
@@ -762,15 +1611,7 @@ namespace vkCore
   {
     auto barrierInfo = getImageMemoryBarrierInfo( image, oldLayout, newLayout );
 
-    commandBuffer.pipelineBarrier( std::get<1>( barrierInfo ), // srcStageMask
-                                   std::get<2>( barrierInfo ), // dstStageMask
-                                   vk::DependencyFlagBits::eByRegion,
-                                   0,
-                                   nullptr,
-                                   0,
-                                   nullptr,
-                                   1,
-                                   &std::get<0>( barrierInfo ) ); // barrier
+    recordImageMemoryBarrier( commandBuffer, barrierInfo );
   }
 
   inline auto getPipelineShaderStageCreateInfo( vk::ShaderStageFlagBits stage, vk::ShaderModule module, const char* name = "main", vk::SpecializationInfo* specializationInfo = nullptr ) -> vk::PipelineShaderStageCreateInfo
@@ -1016,20 +1857,27 @@ namespace vkCore
 
   inline auto initDevice( std::vector<const char*>& extensions, const std::optional<vk::PhysicalDeviceFeatures>& features, const std::optional<vk::PhysicalDeviceFeatures2>& features2 = { } ) -> vk::Device
   {
+    // Synchronization2 is used automatically whenever the device supports it.
+    std::optional<vk::PhysicalDeviceFeatures2> enabledFeatures2 = features2;
+#ifdef VK_KHR_synchronization2
+    vk::PhysicalDeviceSynchronization2FeaturesKHR synchronization2Features;
+    details::enableSynchronization2( extensions, features, enabledFeatures2, synchronization2Features );
+#endif
+
     checkDeviceExtensionSupport( extensions );
 
     auto queueCreateInfos = getDeviceQueueCreateInfos( );
 
-    vk::DeviceCreateInfo createInfo( { },                                                                                           // flags
-                                     static_cast<uint32_t>( queueCreateInfos.size( ) ),                                             // queueCreateInfoCount
-                                     queueCreateInfos.data( ),                                                                      // pQueueCreateInfos
-                                     0,                                                                                             // enabledLayerCount
-                                     nullptr,                                                                                       // ppEnabledLayerNames
-                                     static_cast<uint32_t>( extensions.size( ) ),                                                   // enabledExtensionCount
-                                     extensions.data( ),                                                                            // ppEnabledExtensionNames
-                                     features2.has_value( ) ? nullptr : ( features.has_value( ) ? &features.value( ) : nullptr ) ); // pEnabledFeatures - must be NULL because the VkDeviceCreateInfo::pNext chain includes VkPhysicalDeviceFeatures2.
+    vk::DeviceCreateInfo createInfo( { },                                                                                                  // flags
+                                     static_cast<uint32_t>( queueCreateInfos.size( ) ),                                                    // queueCreateInfoCount
+                                     queueCreateInfos.data( ),                                                                             // pQueueCreateInfos
+                                     0,                                                                                                    // enabledLayerCount
+                                     nullptr,                                                                                              // ppEnabledLayerNames
+                                     static_cast<uint32_t>( extensions.size( ) ),                                                          // enabledExtensionCount
+                                     extensions.data( ),                                                                                   // ppEnabledExtensionNames
+                                     enabledFeatures2.has_value( ) ? nullptr : ( features.has_value( ) ? &features.value( ) : nullptr ) ); // pEnabledFeatures - must be NULL because the VkDeviceCreateInfo::pNext chain includes VkPhysicalDeviceFeatures2.
 
-    createInfo.pNext = features2.has_value( ) ? &features2.value( ) : nullptr;
+    createInfo.pNext = enabledFeatures2.has_value( ) ? &enabledFeatures2.value( ) : nullptr;
 
     auto device    = global::physicalDevice.createDevice( createInfo );
     global::device = device;
@@ -1037,6 +1885,10 @@ namespace vkCore
 
     VULKAN_HPP_DEFAULT_DISPATCHER.init( device );
 
+    global::timelineSemaphores = details::isTimelineSemaphoreEnabled( enabledFeatures2 );
+    global::synchronization2   = details::isSynchronization2Enabled( extensions, enabledFeatures2 );
+    global::externalMemoryHost = details::isExternalMemoryHostEnabled( extensions );
+
     return device;
   }
 
@@ -1211,20 +2063,27 @@ namespace vkCore
 
   inline auto initDeviceUnique( std::vector<const char*>& extensions, const std::optional<vk::PhysicalDeviceFeatures>& features, const std::optional<vk::PhysicalDeviceFeatures2>& features2 = { } ) -> vk::UniqueDevice
   {
+    // Synchronization2 is used automatically whenever the device supports it.
+    std::optional<vk::PhysicalDeviceFeatures2> enabledFeatures2 = features2;
+#ifdef VK_KHR_synchronization2
+    vk::PhysicalDeviceSynchronization2FeaturesKHR synchronization2Features;
+    details::enableSynchronization2( extensions, features, enabledFeatures2, synchronization2Features );
+#endif
+
     checkDeviceExtensionSupport( extensions );
 
     auto queueCreateInfos = getDeviceQueueCreateInfos( );
 
-    vk::DeviceCreateInfo createInfo( { },                                                                                           // flags
-                                     static_cast<uint32_t>( queueCreateInfos.size( ) ),                                             // queueCreateInfoCount
-                                     queueCreateInfos.data( ),                                                                      // pQueueCreateInfos
-                                     0,                                                                                             // enabledLayerCount
-                                     nullptr,                                                                                       // ppEnabledLayerNames
-                                     static_cast<uint32_t>( extensions.size( ) ),                                                   // enabledExtensionCount
-                                     extensions.data( ),                                                                            // ppEnabledExtensionNames
-                                     features2.has_value( ) ? nullptr : ( features.has_value( ) ? &features.value( ) : nullptr ) ); // pEnabledFeatures - must be NULL because the VkDeviceCreateInfo::pNext chain includes VkPhysicalDeviceFeatures2.
+    vk::DeviceCreateInfo createInfo( { },                                                                                                  // flags
+                                     static_cast<uint32_t>( queueCreateInfos.size( ) ),                                                    // queueCreateInfoCount
+                                     queueCreateInfos.data( ),                                                                             // pQueueCreateInfos
+                                     0,                                                                                                    // enabledLayerCount
+                                     nullptr,                                                                                              // ppEnabledLayerNames
+                                     static_cast<uint32_t>( extensions.size( ) ),                                                          // enabledExtensionCount
+                                     extensions.data( ),                                                                                   // ppEnabledExtensionNames
+                                     enabledFeatures2.has_value( ) ? nullptr : ( features.has_value( ) ? &features.value( ) : nullptr ) ); // pEnabledFeatures - must be NULL because the VkDeviceCreateInfo::pNext chain includes VkPhysicalDeviceFeatures2.
 
-    createInfo.pNext = features2.has_value( ) ? &features2.value( ) : nullptr;
+    createInfo.pNext = enabledFeatures2.has_value( ) ? &enabledFeatures2.value( ) : nullptr;
 
     auto device    = global::physicalDevice.createDeviceUnique( createInfo );
     global::device = device.get( );
@@ -1232,6 +2091,10 @@ namespace vkCore
 
     VULKAN_HPP_DEFAULT_DISPATCHER.init( device.get( ) );
 
+    global::timelineSemaphores = details::isTimelineSemaphoreEnabled( enabledFeatures2 );
+    global::synchronization2   = details::isSynchronization2Enabled( extensions, enabledFeatures2 );
+    global::externalMemoryHost = details::isExternalMemoryHostEnabled( extensions );
+
     return std::move( device );
   }
 
@@ -1241,588 +2104,4571 @@ namespace vkCore
   // Classes
   // --------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------------
 
-  /// A wrapper class for Vulkan command buffer objects.
-  class CommandBuffer
+  /// Describes a region of device memory handed out by vkCore::Allocator.
+  struct Allocation
+  {
+    vk::DeviceMemory memory               = nullptr; ///< The Vulkan device memory the allocation lives in.
+    vk::DeviceSize offset                 = 0;       ///< The allocation's offset inside memory.
+    vk::DeviceSize size                   = 0;       ///< The allocation's size.
+    void* mapped                          = nullptr; ///< Points to the allocation's first byte if the memory is host visible.
+    uint32_t memoryTypeIndex              = 0U;      ///< The memory type the allocation was made from.
+    vk::MemoryPropertyFlags propertyFlags = { };     ///< The properties of the memory type the allocation was made from.
+    uint32_t pool                         = 0U;      ///< The allocator's internal pool index (Only used if the allocation is not dedicated).
+    bool dedicated                        = false;   ///< If true, the allocation owns its Vulkan device memory exclusively.
+    bool imported                         = false;   ///< If true, the memory imports host memory owned by the application, which mapped points to.
+  };
+
+  /// A block-based device memory sub-allocator.
+  ///
+  /// Device memory is requested from the driver in large blocks per memory type which are then split up using a first-fit free list.
+  /// Linear resources (buffers and linearly tiled images) and optimally tiled images never share a block, so neighbouring allocations cannot violate the physical device's bufferImageGranularity.
+  /// Host visible blocks are mapped persistently for their entire lifetime.
+  /// @note The allocator initializes itself lazily on the first allocation.
+  /// @warning destroy() must be called before the logical device is destroyed.
+  /// @ingroup API
+  class Allocator
   {
   public:
-    CommandBuffer( ) = default;
+    Allocator( ) = default;
+
+    Allocator( const Allocator& )  = delete;
+    Allocator( const Allocator&& ) = delete;
 
-    /// Call to init(vk::CommandPool, uint32_t, vk::CommandBufferUsageFlags).
-    CommandBuffer( vk::CommandPool commandPool, uint32_t count = 1, vk::CommandBufferUsageFlags usageFlags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit )
+    auto operator=( const Allocator& ) -> Allocator& = delete;
+    auto operator=( const Allocator&& ) -> Allocator& = delete;
+
+    /// @return Returns the size of each memory block requested from the driver.
+    auto getBlockSize( ) const -> vk::DeviceSize { return _blockSize; }
+
+    /// @return Returns the amount of Vulkan device memory allocations currently owned by the allocator.
+    auto getAllocationCount( ) const -> uint32_t { return _allocationCount; }
+
+    /// Sets up the allocator.
+    /// @param blockSize The size of each memory block requested from the driver. Resources larger than half a block receive a dedicated allocation.
+    void init( vk::DeviceSize blockSize = 64ULL * 1024ULL * 1024ULL )
     {
-      init( commandPool, count, usageFlags );
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      _blockSize        = blockSize;
+      _memoryProperties = global::physicalDevice.getMemoryProperties( );
+      _initialized      = true;
     }
 
-    /// Creates the command buffers.
-    /// @param commandPool The command pool from which the command buffers will be allocated from.
-    /// @param count The amount of Vulkan command buffers to initialize (the same as the amount of images in the swapchain).
-    /// @param usageFlags Specifies what the buffer will be used for.
-    void init( vk::CommandPool commandPool, uint32_t count = 1, vk::CommandBufferUsageFlags usageFlags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit )
+    /// Allocates memory for a resource.
+    /// @param memoryRequirements The resource's memory requirements.
+    /// @param propertyFlags The memory properties the allocation must have.
+    /// @param linear Must be true for buffers and linearly tiled images and false for optimally tiled images.
+    /// @param dedicated If true, the allocation will not be sub-allocated but receive its own Vulkan device memory.
+    /// @param pNext Attachment to the memory's pNext chain. Anything but a single vk::MemoryAllocateFlagsInfo results in a dedicated allocation.
+    /// @param preferredFlags The memory properties the allocation should have if possible.
+    /// @return Returns the allocation.
+    auto allocate( const vk::MemoryRequirements& memoryRequirements, vk::MemoryPropertyFlags propertyFlags, bool linear, bool dedicated = false, const void* pNext = nullptr, vk::MemoryPropertyFlags preferredFlags = { } ) -> Allocation
     {
-      _commandPool = commandPool;
-
-      _commandBuffers.resize( count );
+      ensureInitialized( );
 
-      vk::CommandBufferAllocateInfo allocateInfo( commandPool,                      // commandPool
-                                                  vk::CommandBufferLevel::ePrimary, // level
-                                                  count );                          // commandBufferCount
+      uint32_t memoryTypeIndex = findMemoryType( global::physicalDevice, memoryRequirements.memoryTypeBits, propertyFlags, preferredFlags );
 
-      _commandBuffers = global::device.allocateCommandBuffers( allocateInfo );
-      for ( const vk::CommandBuffer& commandBuffer : _commandBuffers )
+      if ( preferredFlags )
       {
-        VK_CORE_ASSERT( commandBuffer, "Failed to create command buffers." );
+        // Preferred memory types might live on a small heap (e.g. the ReBAR window). Fall back to the required properties if it runs out.
+        uint32_t fallbackIndex = findMemoryType( global::physicalDevice, memoryRequirements.memoryTypeBits, propertyFlags );
+
+        if ( fallbackIndex != memoryTypeIndex )
+        {
+          try
+          {
+            return allocateFromType( memoryRequirements, memoryTypeIndex, linear, dedicated, pNext );
+          }
+          catch ( const vk::OutOfDeviceMemoryError& )
+          {
+            memoryTypeIndex = fallbackIndex;
+          }
+        }
       }
 
-      // Set up begin info.
-      _beginInfo.flags = usageFlags;
+      return allocateFromType( memoryRequirements, memoryTypeIndex, linear, dedicated, pNext );
     }
 
-    auto get( ) const -> const std::vector<vk::CommandBuffer> { return _commandBuffers; }
+#ifdef VK_EXT_external_memory_host
+    /// Imports host memory as a dedicated allocation using VK_EXT_external_memory_host.
+    /// @param hostPointer The host memory to import. Both the pointer and size must be multiples of getMinImportedHostPointerAlignment().
+    /// @param size The size of the host memory in bytes.
+    /// @param memoryTypeBits The memory types supported by the resource the memory is imported for.
+    /// @return Returns the allocation. Its mapped pointer is the host pointer itself.
+    /// @note The host memory must stay valid until the allocation has been freed.
+    auto importHostPointer( void* hostPointer, vk::DeviceSize size, uint32_t memoryTypeBits ) -> Allocation
+    {
+      VK_CORE_ASSERT( global::externalMemoryHost, "VK_EXT_external_memory_host is not enabled." );
 
-    auto get( size_t index ) const -> const vk::CommandBuffer { return _commandBuffers[index]; }
+      ensureInitialized( );
 
-    void free( )
+      auto hostPointerProperties = global::device.getMemoryHostPointerPropertiesEXT( vk::ExternalMemoryHandleTypeFlagBits::eHostAllocationEXT, hostPointer );
+      uint32_t memoryTypeIndex   = findMemoryType( global::physicalDevice, memoryTypeBits & hostPointerProperties.memoryTypeBits, vk::MemoryPropertyFlagBits::eHostVisible );
+
+      vk::ImportMemoryHostPointerInfoEXT importInfo( vk::ExternalMemoryHandleTypeFlagBits::eHostAllocationEXT, // handleType
+                                                     hostPointer );                                            // pHostPointer
+
+      vk::MemoryAllocateInfo allocateInfo( size,              // allocationSize
+                                           memoryTypeIndex ); // memoryTypeIndex
+
+      allocateInfo.pNext = &importInfo;
+
+      Allocation allocation;
+      allocation.memory = global::device.allocateMemory( allocateInfo );
+      VK_CORE_ASSERT( allocation.memory, "Failed to import host memory." );
+
+      allocation.size            = size;
+      allocation.mapped          = hostPointer;
+      allocation.memoryTypeIndex = memoryTypeIndex;
+      allocation.propertyFlags   = _memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+      allocation.dedicated       = true;
+      allocation.imported        = true;
+
+      std::lock_guard<std::mutex> lock( _mutex );
+      ++_allocationCount;
+
+      return allocation;
+    }
+#endif
+
+    /// Returns an allocation to the allocator.
+    /// @param allocation The allocation to release.
+    void free( const Allocation& allocation )
     {
-      global::device.freeCommandBuffers( _commandPool, static_cast<uint32_t>( _commandBuffers.size( ) ), _commandBuffers.data( ) );
+      if ( !allocation.memory )
+      {
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      if ( allocation.dedicated )
+      {
+        // Imported host memory was never mapped.
+        releaseMemory( allocation.memory, allocation.imported ? nullptr : allocation.mapped );
+        return;
+      }
+
+      Pool& pool = _pools[allocation.pool];
+      for ( auto it = pool.blocks.begin( ); it != pool.blocks.end( ); ++it )
+      {
+        if ( it->memory == allocation.memory )
+        {
+          it->give( allocation.offset, allocation.size );
+
+          // Keep one empty block around per pool to avoid allocation ping-pong.
+          if ( it->used == 0 && pool.blocks.size( ) > 1 )
+          {
+            releaseMemory( it->memory, it->mapped );
+            pool.blocks.erase( it );
+          }
+
+          return;
+        }
+      }
+
+      VK_CORE_THROW( "Failed to free allocation. The memory does not belong to the allocator." );
     }
 
-    void reset( )
+    /// Records a range of a mapped allocation that was written to by the host.
+    ///
+    /// The range will be made visible to the device by the next call to flush(). Ranges inside host coherent memory are ignored.
+    /// @param allocation The allocation that was written to.
+    /// @param offset The range's offset relative to the allocation.
+    /// @param size The range's size in bytes.
+    void markDirty( const Allocation& allocation, vk::DeviceSize offset, vk::DeviceSize size )
     {
-      for ( vk::CommandBuffer& buffer : _commandBuffers )
+      if ( allocation.mapped == nullptr || size == 0 || ( allocation.propertyFlags & vk::MemoryPropertyFlagBits::eHostCoherent ) )
       {
-        buffer.reset( vk::CommandBufferResetFlagBits::eReleaseResources );
+        return;
       }
+
+      std::lock_guard<std::mutex> lock( _mutex );
+      _dirtyRanges.push_back( getMappedMemoryRange( allocation, offset, size ) );
     }
 
-    /// Used to begin the command buffer recording.
-    /// @param index An index to a command buffer to record to.
-    void begin( size_t index = 0 )
+    /// Flushes all ranges recorded by markDirty() using a single call to vkFlushMappedMemoryRanges.
+    /// @note Call this once per frame, before submitting work that reads host written data, e.g. using Sync::endFrame(). global::transferEngine calls it before every submission.
+    void flush( )
     {
-      _commandBuffers[index].begin( _beginInfo );
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      if ( _dirtyRanges.empty( ) )
+      {
+        return;
+      }
+
+      // Merge overlapping ranges of the same memory object.
+      std::sort( _dirtyRanges.begin( ), _dirtyRanges.end( ), []( const vk::MappedMemoryRange& a, const vk::MappedMemoryRange& b ) {
+        return a.memory == b.memory ? a.offset < b.offset : a.memory < b.memory;
+      } );
+
+      std::vector<vk::MappedMemoryRange> ranges;
+      ranges.reserve( _dirtyRanges.size( ) );
+
+      for ( const auto& range : _dirtyRanges )
+      {
+        if ( !ranges.empty( ) && ranges.back( ).memory == range.memory && ( ranges.back( ).size == VK_WHOLE_SIZE || ranges.back( ).offset + ranges.back( ).size >= range.offset ) )
+        {
+          vk::MappedMemoryRange& last = ranges.back( );
+          if ( last.size != VK_WHOLE_SIZE )
+          {
+            last.size = range.size == VK_WHOLE_SIZE ? VK_WHOLE_SIZE : std::max( last.offset + last.size, range.offset + range.size ) - last.offset;
+          }
+        }
+        else
+        {
+          ranges.push_back( range );
+        }
+      }
+
+      if ( global::device.flushMappedMemoryRanges( static_cast<uint32_t>( ranges.size( ) ), ranges.data( ) ) != vk::Result::eSuccess )
+      {
+        VK_CORE_THROW( "Failed to flush mapped memory ranges." );
+      }
+
+      _dirtyRanges.clear( );
     }
 
-    /// Used to stop the command buffer recording.
-    /// @param index An index to a command buffer to stop recording.
-    void end( size_t index = 0 )
+    /// Makes device writes to a range of a mapped allocation visible to the host. Ranges inside host coherent memory are ignored.
+    /// @param allocation The allocation to read from.
+    /// @param offset The range's offset relative to the allocation.
+    /// @param size The range's size in bytes.
+    /// @note The device writes must have been made available to the host first, e.g. by waiting for a fence.
+    void invalidate( const Allocation& allocation, vk::DeviceSize offset = 0, vk::DeviceSize size = VK_WHOLE_SIZE )
     {
-      _commandBuffers[index].end( );
+      if ( allocation.mapped == nullptr || ( allocation.propertyFlags & vk::MemoryPropertyFlagBits::eHostCoherent ) )
+      {
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      vk::MappedMemoryRange range = getMappedMemoryRange( allocation, offset, size == VK_WHOLE_SIZE ? allocation.size - offset : size );
+
+      if ( global::device.invalidateMappedMemoryRanges( 1, &range ) != vk::Result::eSuccess )
+      {
+        VK_CORE_THROW( "Failed to invalidate mapped memory ranges." );
+      }
     }
 
-    /// Submits the recorded commands to a queue.
-    /// @param queue The queue to submit to.
-    /// @param waitSemaphores A std::vector of semaphores to wait for.
-    /// @param signalSemaphores A std::vector of semaphores to signal.
-    /// @param waitDstStageMask The pipeline stage where the commands will be executed.
-    void submitToQueue( vk::Queue queue, vk::Fence fence = nullptr, const std::vector<vk::Semaphore>& waitSemaphores = { }, const std::vector<vk::Semaphore>& signalSemaphores = { }, vk::PipelineStageFlags* waitDstStageMask = { } )
+    /// Frees all memory blocks owned by the allocator.
+    /// @note Any allocation still in use is invalid afterwards.
+    void destroy( )
     {
-      if ( _beginInfo.flags & vk::CommandBufferUsageFlagBits::eOneTimeSubmit )
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      for ( Pool& pool : _pools )
       {
-        vk::SubmitInfo submitInfo( static_cast<uint32_t>( waitSemaphores.size( ) ),   // waitSemaphoreCount
-                                   waitSemaphores.data( ),                            // pWaitSemaphores
-                                   waitDstStageMask,                                  // pWaitDstStageMask
-                                   static_cast<uint32_t>( _commandBuffers.size( ) ),  // commandBufferCount
-                                   _commandBuffers.data( ),                           // pCommandBuffers
-                                   static_cast<uint32_t>( signalSemaphores.size( ) ), // signalSemaphoreCount
-                                   signalSemaphores.data( ) );                        // pSignalSemaphores
+        for ( Block& block : pool.blocks )
+        {
+          releaseMemory( block.memory, block.mapped );
+        }
+      }
 
-        if ( queue.submit( 1, &submitInfo, fence ) != vk::Result::eSuccess )
+      _pools.clear( );
+      _initialized = false;
+    }
+
+  private:
+    /// Sets up the allocator with its current block size unless this already happened.
+    ///
+    /// The check happens under the lock, so concurrent first allocations do not race with each other or with init().
+    void ensureInitialized( )
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      if ( !_initialized )
+      {
+        _memoryProperties = global::physicalDevice.getMemoryProperties( );
+        _initialized      = true;
+      }
+    }
+
+    /// Allocates memory from a specific memory type.
+    auto allocateFromType( const vk::MemoryRequirements& memoryRequirements, uint32_t memoryTypeIndex, bool linear, bool dedicated, const void* pNext ) -> Allocation
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      // Allocate flags (e.g. device address support) apply to an entire block and are therefore part of the pool's key.
+      vk::MemoryAllocateFlags allocateFlags;
+      if ( pNext != nullptr )
+      {
+        const auto* base = static_cast<const vk::BaseInStructure*>( pNext );
+        if ( base->sType == vk::StructureType::eMemoryAllocateFlagsInfo && base->pNext == nullptr )
         {
-          VK_CORE_THROW( "Failed to submit" );
+          allocateFlags = static_cast<const vk::MemoryAllocateFlagsInfo*>( pNext )->flags;
+        }
+        else
+        {
+          dedicated = true;
         }
+      }
 
-        queue.waitIdle( );
+      if ( dedicated || memoryRequirements.size > _blockSize / 2 )
+      {
+        return allocateDedicated( memoryRequirements.size, memoryTypeIndex, pNext );
       }
-      else
+
+      uint32_t poolIndex = getPool( memoryTypeIndex, linear, allocateFlags );
+      Pool& pool         = _pools[poolIndex];
+
+      for ( Block& block : pool.blocks )
       {
-        VK_CORE_THROW( "Only command buffers with a usage flag containing eOneTimeSubmit should be submitted automatically" );
+        if ( auto offset = block.take( memoryRequirements.size, memoryRequirements.alignment ); offset.has_value( ) )
+        {
+          return getAllocation( block, offset.value( ), memoryRequirements.size, memoryTypeIndex, poolIndex );
+        }
       }
+
+      // None of the existing blocks has enough space left.
+      vk::MemoryAllocateFlagsInfo allocateFlagsInfo( allocateFlags );
+      Allocation blockAllocation = allocateDedicated( _blockSize, memoryTypeIndex, allocateFlags ? &allocateFlagsInfo : nullptr );
+
+      Block block;
+      block.memory = blockAllocation.memory;
+      block.size   = _blockSize;
+      block.mapped = blockAllocation.mapped;
+      block.freeRanges.emplace( 0, _blockSize );
+
+      auto offset = block.take( memoryRequirements.size, memoryRequirements.alignment );
+      VK_CORE_ASSERT( offset.has_value( ), "Failed to sub-allocate memory from a new block." );
+
+      pool.blocks.push_back( std::move( block ) );
+      return getAllocation( pool.blocks.back( ), offset.value( ), memoryRequirements.size, memoryTypeIndex, poolIndex );
     }
 
-  private:
-    std::vector<vk::CommandBuffer> _commandBuffers;
+    struct Block
+    {
+      /// Finds a free range using first-fit and removes it from the free list.
+      /// @return Returns the aligned offset of the range if one was found.
+      auto take( vk::DeviceSize size, vk::DeviceSize alignment ) -> std::optional<vk::DeviceSize>
+      {
+        alignment = std::max<vk::DeviceSize>( alignment, 1 );
 
-    vk::CommandPool _commandPool; ///< The command pool used to allocate the command buffer from.
-    vk::CommandBufferBeginInfo _beginInfo;
-  };
+        for ( auto it = freeRanges.begin( ); it != freeRanges.end( ); ++it )
+        {
+          vk::DeviceSize begin   = it->first;
+          vk::DeviceSize end     = it->first + it->second;
+          vk::DeviceSize aligned = ( begin + alignment - 1 ) / alignment * alignment;
 
-  // @todo move up to functions.
-  /// Transitions the image layout of any given image. The function will generate its own command buffer.
-  /// @param image The vulkan image for which you want to change the image layout.
-  /// @param oldLayout The current image layout of the given vulkan image.
-  /// @param newLayout The target image layout.
-  inline void transitionImageLayout( vk::Image image, vk::ImageLayout oldLayout, vk::ImageLayout newLayout )
-  {
-    auto barrierInfo = getImageMemoryBarrierInfo( image, oldLayout, newLayout );
+          if ( aligned + size > end )
+          {
+            continue;
+          }
 
-    CommandBuffer commandBuffer;
-    commandBuffer.init( global::graphicsCmdPool );
-    commandBuffer.begin( );
+          freeRanges.erase( it );
 
-    commandBuffer.get( 0 ).pipelineBarrier( std::get<1>( barrierInfo ), // srcStageMask
-                                            std::get<2>( barrierInfo ), // dstStageMask
-                                            vk::DependencyFlagBits::eByRegion,
-                                            0,
-                                            nullptr,
-                                            0,
-                                            nullptr,
-                                            1,
-                                            &std::get<0>( barrierInfo ) ); // barrier
+          if ( aligned > begin )
+          {
+            freeRanges.emplace( begin, aligned - begin );
+          }
 
-    commandBuffer.end( );
-    commandBuffer.submitToQueue( global::graphicsQueue );
-  }
+          if ( aligned + size < end )
+          {
+            freeRanges.emplace( aligned + size, end - aligned - size );
+          }
 
-  /// A wrapper class for a Vulkan image.
-  /// @ingroup API
-  class Image
-  {
-  public:
-    auto get( ) const -> vk::Image { return _image.get( ); }
+          used += size;
+          return aligned;
+        }
 
-    auto getExtent( ) const -> vk::Extent3D { return _extent; }
+        return { };
+      }
 
-    auto getFormat( ) const -> vk::Format { return _format; }
+      /// Adds a range back to the free list and merges it with its neighbours.
+      void give( vk::DeviceSize offset, vk::DeviceSize size )
+      {
+        used -= size;
 
-    auto getLayout( ) const -> vk::ImageLayout { return _layout; }
+        auto it = freeRanges.emplace( offset, size ).first;
 
-    /// Creates the image and allocates memory for it.
-    /// @param createInfo The Vulkan image create info.
-    void init( const vk::ImageCreateInfo& createInfo )
+        auto next = std::next( it );
+        if ( next != freeRanges.end( ) && it->first + it->second == next->first )
+        {
+          it->second += next->second;
+          freeRanges.erase( next );
+        }
+
+        if ( it != freeRanges.begin( ) )
+        {
+          auto previous = std::prev( it );
+          if ( previous->first + previous->second == it->first )
+          {
+            previous->second += it->second;
+            freeRanges.erase( it );
+          }
+        }
+      }
+
+      vk::DeviceMemory memory = nullptr;
+      vk::DeviceSize size     = 0;
+      vk::DeviceSize used     = 0;
+      void* mapped            = nullptr;
+
+      std::map<vk::DeviceSize, vk::DeviceSize> freeRanges; ///< Maps offsets of free ranges to their sizes.
+    };
+
+    struct Pool
     {
-      _extent = createInfo.extent;
-      _format = createInfo.format;
-      _layout = createInfo.initialLayout;
+      uint32_t memoryTypeIndex = 0U;
+      bool linear              = true;
+      vk::MemoryAllocateFlags allocateFlags;
+      std::vector<Block> blocks;
+    };
 
-      _image = global::device.createImageUnique( createInfo );
-      VK_CORE_ASSERT( _image.get( ), "Failed to create image" );
-      _memory = allocateMemoryUnique( _image.get( ), vk::MemoryPropertyFlagBits::eDeviceLocal );
-      global::device.bindImageMemory( _image.get( ), _memory.get( ), 0 );
+    auto getPool( uint32_t memoryTypeIndex, bool linear, vk::MemoryAllocateFlags allocateFlags ) -> uint32_t
+    {
+      for ( size_t i = 0; i < _pools.size( ); ++i )
+      {
+        if ( _pools[i].memoryTypeIndex == memoryTypeIndex && _pools[i].linear == linear && _pools[i].allocateFlags == allocateFlags )
+        {
+          return static_cast<uint32_t>( i );
+        }
+      }
+
+      Pool pool;
+      pool.memoryTypeIndex = memoryTypeIndex;
+      pool.linear          = linear;
+      pool.allocateFlags   = allocateFlags;
+
+      _pools.push_back( std::move( pool ) );
+      return static_cast<uint32_t>( _pools.size( ) - 1 );
     }
 
-    /// Used to transition this image's layout.
-    /// @param layout The target layout.
-    /// @param subresourceRange Optionally used to define a non-standard subresource range.
-    /// @note This function creates its own single-time usage command buffer.
-    void transitionToLayout( vk::ImageLayout layout, const vk::ImageSubresourceRange* subresourceRange = nullptr )
+    auto getAllocation( const Block& block, vk::DeviceSize offset, vk::DeviceSize size, uint32_t memoryTypeIndex, uint32_t poolIndex ) const -> Allocation
     {
-      auto barrierInfo = getImageMemoryBarrierInfo( _image.get( ), _layout, layout, subresourceRange );
+      Allocation allocation;
+      allocation.memory          = block.memory;
+      allocation.offset          = offset;
+      allocation.size            = size;
+      allocation.mapped          = block.mapped != nullptr ? static_cast<char*>( block.mapped ) + offset : nullptr;
+      allocation.memoryTypeIndex = memoryTypeIndex;
+      allocation.propertyFlags   = _memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+      allocation.pool            = poolIndex;
+      allocation.dedicated       = false;
+
+      return allocation;
+    }
 
-      CommandBuffer commandBuffer;
-      commandBuffer.init( global::graphicsCmdPool );
-      commandBuffer.begin( );
+    auto allocateDedicated( vk::DeviceSize size, uint32_t memoryTypeIndex, const void* pNext ) -> Allocation
+    {
+      vk::MemoryAllocateInfo allocateInfo( size,              // allocationSize
+                                           memoryTypeIndex ); // memoryTypeIndex
 
-      commandBuffer.get( 0 ).pipelineBarrier( std::get<1>( barrierInfo ), // srcStageMask
-                                              std::get<2>( barrierInfo ), // dstStageMask
-                                              vk::DependencyFlagBits::eByRegion,
-                                              0,
-                                              nullptr,
-                                              0,
-                                              nullptr,
-                                              1,
-                                              &std::get<0>( barrierInfo ) ); // barrier
+      allocateInfo.pNext = pNext;
 
-      commandBuffer.end( );
-      commandBuffer.submitToQueue( global::graphicsQueue );
+      Allocation allocation;
+      allocation.memory = global::device.allocateMemory( allocateInfo );
+      VK_CORE_ASSERT( allocation.memory, "Failed to allocate memory." );
+
+      allocation.size            = size;
+      allocation.memoryTypeIndex = memoryTypeIndex;
+      allocation.propertyFlags   = _memoryProperties.memoryTypes[memoryTypeIndex].propertyFlags;
+      allocation.dedicated       = true;
+
+      if ( allocation.propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible )
+      {
+        if ( global::device.mapMemory( allocation.memory, 0, VK_WHOLE_SIZE, { }, &allocation.mapped ) != vk::Result::eSuccess )
+        {
+          VK_CORE_THROW( "Failed to map memory." );
+        }
+      }
+
+      ++_allocationCount;
 
-      _layout = layout;
+      return allocation;
     }
 
-    /// Used to transition this image's layout using an already existing command buffer.
-    /// @param layout The target layout
-    /// @param commandBuffer The command buffer that will be used to set up a pipeline barrier.
-    /// @param subresourceRange Optionally used to define a non-standard subresource range.
-    void transitionToLayout( vk::ImageLayout layout, vk::CommandBuffer commandBuffer, const vk::ImageSubresourceRange* subresourceRange = nullptr )
+    /// Converts a range relative to an allocation to a range relative to its memory that respects nonCoherentAtomSize.
+    auto getMappedMemoryRange( const Allocation& allocation, vk::DeviceSize offset, vk::DeviceSize size ) const -> vk::MappedMemoryRange
     {
-      auto barrierInfo = getImageMemoryBarrierInfo( _image.get( ), _layout, layout, subresourceRange );
+      vk::DeviceSize atomSize = std::max<vk::DeviceSize>( global::physicalDeviceLimits.nonCoherentAtomSize, 1 );
+
+      vk::DeviceSize memorySize = allocation.dedicated ? allocation.size : _blockSize;
+      if ( !allocation.dedicated )
+      {
+        for ( const Block& block : _pools[allocation.pool].blocks )
+        {
+          if ( block.memory == allocation.memory )
+          {
+            memorySize = block.size;
+            break;
+          }
+        }
+      }
 
-      commandBuffer.pipelineBarrier( std::get<1>( barrierInfo ), // srcStageMask
-                                     std::get<2>( barrierInfo ), // dstStageMask
-                                     vk::DependencyFlagBits::eByRegion,
-                                     0,
-                                     nullptr,
-                                     0,
-                                     nullptr,
-                                     1,
-                                     &std::get<0>( barrierInfo ) ); // barrier
+      vk::DeviceSize begin = ( allocation.offset + offset ) / atomSize * atomSize;
+      vk::DeviceSize end   = ( allocation.offset + offset + size + atomSize - 1 ) / atomSize * atomSize;
 
-      _layout = layout;
+      // Ranges reaching the end of the memory object do not need to be a multiple of the atom size.
+      return vk::MappedMemoryRange( allocation.memory, begin, end >= memorySize ? VK_WHOLE_SIZE : end - begin );
     }
 
-  protected:
-    vk::UniqueImage _image;
-    vk::UniqueDeviceMemory _memory;
+    void releaseMemory( vk::DeviceMemory memory, void* mapped )
+    {
+      if ( mapped != nullptr )
+      {
+        global::device.unmapMemory( memory );
+      }
 
-    vk::Extent3D _extent;
-    vk::Format _format;
-    vk::ImageLayout _layout;
+      // Pending ranges of released memory must not be flushed anymore.
+      _dirtyRanges.erase( std::remove_if( _dirtyRanges.begin( ), _dirtyRanges.end( ), [memory]( const vk::MappedMemoryRange& range ) { return range.memory == memory; } ), _dirtyRanges.end( ) );
+
+      global::device.freeMemory( memory );
+      --_allocationCount;
+    }
+
+    std::vector<Pool> _pools;
+    std::vector<vk::MappedMemoryRange> _dirtyRanges; ///< Host writes to non-coherent memory that have not been flushed yet.
+    vk::PhysicalDeviceMemoryProperties _memoryProperties;
+
+    vk::DeviceSize _blockSize = 64ULL * 1024ULL * 1024ULL;
+    uint32_t _allocationCount = 0U;
+    bool _initialized         = false;
+
+    std::mutex _mutex;
   };
 
-  /// A wrapper class for a Vulkan buffer object.
+  namespace global
+  {
+    inline Allocator allocator; ///< The allocator used by all vkCore resources.
+  } // namespace global
+
+  /// Owns an allocation and returns it to global::allocator once it goes out of scope.
   /// @ingroup API
-  class Buffer
+  class UniqueAllocation
   {
   public:
-    Buffer( ) = default;
+    UniqueAllocation( ) = default;
 
-    /// Call to init(k::DeviceSize, vk::BufferUsageFlags, const std::vector<uint32_t>&, vk::MemoryPropertyFlags).
-    Buffer( vk::DeviceSize size, vk::BufferUsageFlags usage, const std::vector<uint32_t>& queueFamilyIndices = { }, vk::MemoryPropertyFlags memoryPropertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal, void* pNextMemory = nullptr )
+    explicit UniqueAllocation( const Allocation& allocation ) :
+      _allocation( allocation )
     {
-      init( size, usage, queueFamilyIndices, memoryPropertyFlags, pNextMemory );
     }
 
-    /// If memory was mapped previously, the destructor will automatically unmap it again.
-    ~Buffer( )
+    ~UniqueAllocation( )
     {
-      if ( _memory && _mapped )
-      {
-        global::device.unmapMemory( _memory.get( ) );
-      }
+      reset( );
     }
 
-    /// @param buffer The target for the copy operation.
-    Buffer( const Buffer& buffer )
+    UniqueAllocation( const UniqueAllocation& ) = delete;
+
+    UniqueAllocation( UniqueAllocation&& other ) noexcept :
+      _allocation( std::exchange( other._allocation, { } ) )
     {
-      copyToBuffer( buffer );
     }
 
-    Buffer( const Buffer&& ) = delete;
+    auto operator=( const UniqueAllocation& ) -> UniqueAllocation& = delete;
 
-    /// Call to copyToBuffer(Buffer).
-    auto operator=( const Buffer& buffer ) -> Buffer&
+    auto operator=( UniqueAllocation&& other ) noexcept -> UniqueAllocation&
     {
-      buffer.copyToBuffer( *this );
+      if ( this != &other )
+      {
+        reset( );
+        _allocation = std::exchange( other._allocation, { } );
+      }
+
       return *this;
     }
 
-    auto operator=( const Buffer&& ) -> Buffer& = delete;
-
-    auto get( ) const -> const vk::Buffer { return _buffer.get( ); }
-
-    auto getMemory( ) const -> const vk::DeviceMemory { return _memory.get( ); }
+    auto get( ) const -> const Allocation& { return _allocation; }
 
-    auto getSize( ) const -> const vk::DeviceSize { return _size; }
+    explicit operator bool( ) const { return static_cast<bool>( _allocation.memory ); }
 
-    /// Creates the buffer and allocates memory for it.
+    /// Returns the allocation to global::allocator.
+    void reset( )
+    {
+      if ( _allocation.memory )
+      {
+        global::allocator.free( _allocation );
+        _allocation = { };
+      }
+    }
+
+  private:
+    Allocation _allocation;
+  };
+
+  /// Allocates memory for a buffer or an image from global::allocator.
+  /// @param object The Vulkan buffer or image.
+  /// @param propertyFlags The memory properties the allocation must have.
+  /// @param dedicated If true, the object receives its own Vulkan device memory.
+  /// @param pNext Attachment to the memory's pNext chain.
+  /// @param linear Must be false for optimally tiled images.
+  /// @param preferredFlags The memory properties the allocation should have if possible.
+  /// @return Returns the allocation with a unique handle.
+  template <typename T>
+  auto allocateUnique( const T& object, vk::MemoryPropertyFlags propertyFlags = { }, bool dedicated = false, const void* pNext = nullptr, bool linear = true, vk::MemoryPropertyFlags preferredFlags = { } ) -> UniqueAllocation
+  {
+    return UniqueAllocation( global::allocator.allocate( getMemoryRequirements( object ), propertyFlags, linear, dedicated, pNext, preferredFlags ) );
+  }
+
+  /// Defers the destruction of resources until the device has finished using them.
+  ///
+  /// Every resource handed to the queue is tagged with the current frame. It is destroyed once release() was called with a frame that is at least as high.
+  /// The queue is disabled until beginFrame() is called for the first time. While it is disabled, resources are destroyed immediately.
+  /// @ingroup API
+  class DeletionQueue
+  {
+  public:
+    DeletionQueue( ) = default;
+
+    DeletionQueue( const DeletionQueue& )  = delete;
+    DeletionQueue( const DeletionQueue&& ) = delete;
+
+    auto operator=( const DeletionQueue& ) -> DeletionQueue& = delete;
+    auto operator=( const DeletionQueue&& ) -> DeletionQueue& = delete;
+
+    /// @return Returns true if resources are deferred.
+    auto isEnabled( ) const -> bool { return _enabled; }
+
+    /// @return Returns the frame new resources are tagged with.
+    auto getFrame( ) const -> uint64_t { return _frame; }
+
+    /// @return Returns the amount of entries waiting to be destroyed.
+    auto getPendingCount( ) -> size_t
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+      return _entries.size( );
+    }
+
+    /// Enables the queue and tags all resources handed over from now on with the given frame.
+    /// @param frame A monotonically increasing frame index or timeline semaphore value.
+    void beginFrame( uint64_t frame )
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      VK_CORE_ASSERT( ( frame >= _frame ), "Frames must increase monotonically." );
+      _frame   = frame;
+      _enabled = true;
+    }
+
+    /// Takes ownership of the given resources if the queue is enabled. Otherwise, the resources are left untouched.
+    ///
+    /// If all resources are empty, e.g. because they were never created or already moved from, nothing is queued.
+    /// @param resources Unique handles or other objects that release a resource on destruction and convert to false if they are empty.
+    /// @return Returns true if the resources were moved into the queue.
+    template <typename... Resources>
+    auto push( Resources&... resources ) -> bool
+    {
+      if ( !( static_cast<bool>( resources ) || ... ) )
+      {
+        return false;
+      }
+
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      if ( !_enabled )
+      {
+        return false;
+      }
+
+      auto entry = std::make_shared<std::tuple<Resources...>>( std::move( resources )... );
+      _entries.push_back( { _frame, std::move( entry ) } );
+
+      return true;
+    }
+
+    /// Destroys all resources tagged with a frame up to and including the given one.
+    /// @param completedFrame The most recent frame the device has finished executing.
+    void release( uint64_t completedFrame )
+    {
+      std::deque<Entry> expired;
+
+      {
+        std::lock_guard<std::mutex> lock( _mutex );
+
+        while ( !_entries.empty( ) && _entries.front( ).frame <= completedFrame )
+        {
+          expired.push_back( std::move( _entries.front( ) ) );
+          _entries.pop_front( );
+        }
+      }
+
+      // Destroy the resources in the order they were handed over, outside of the lock.
+      while ( !expired.empty( ) )
+      {
+        expired.pop_front( );
+      }
+    }
+
+    /// Disables the queue and destroys all remaining resources.
+    /// @note Must be called after the device is idle and before global::allocator is destroyed.
+    void destroy( )
+    {
+      std::deque<Entry> entries;
+
+      {
+        std::lock_guard<std::mutex> lock( _mutex );
+
+        _enabled = false;
+        _frame   = 0;
+        std::swap( entries, _entries );
+      }
+
+      while ( !entries.empty( ) )
+      {
+        entries.pop_front( );
+      }
+    }
+
+  private:
+    struct Entry
+    {
+      uint64_t frame = 0;
+      std::shared_ptr<void> resources;
+    };
+
+    std::deque<Entry> _entries; ///< All deferred resources, oldest first.
+
+    uint64_t _frame = 0;
+    bool _enabled   = false;
+
+    std::mutex _mutex;
+  };
+
+  namespace global
+  {
+    inline DeletionQueue deletionQueue; ///< The queue all vkCore resources hand their handles to on destruction.
+  } // namespace global
+
+  /// A wrapper class for Vulkan command buffer objects.
+  class CommandBuffer
+  {
+  public:
+    CommandBuffer( ) = default;
+
+    /// Call to init(vk::CommandPool, uint32_t, vk::CommandBufferUsageFlags, vk::CommandBufferLevel).
+    CommandBuffer( vk::CommandPool commandPool, uint32_t count = 1, vk::CommandBufferUsageFlags usageFlags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit, vk::CommandBufferLevel level = vk::CommandBufferLevel::ePrimary )
+    {
+      init( commandPool, count, usageFlags, level );
+    }
+
+    /// Creates the command buffers.
+    /// @param commandPool The command pool from which the command buffers will be allocated from.
+    /// @param count The amount of Vulkan command buffers to initialize (the same as the amount of images in the swapchain).
+    /// @param usageFlags Specifies what the buffer will be used for.
+    /// @param level Specifies if the command buffers are primary or secondary command buffers.
+    void init( vk::CommandPool commandPool, uint32_t count = 1, vk::CommandBufferUsageFlags usageFlags = vk::CommandBufferUsageFlagBits::eOneTimeSubmit, vk::CommandBufferLevel level = vk::CommandBufferLevel::ePrimary )
+    {
+      _commandPool = commandPool;
+      _level       = level;
+
+      _commandBuffers.resize( count );
+
+      vk::CommandBufferAllocateInfo allocateInfo( commandPool, // commandPool
+                                                  level,       // level
+                                                  count );     // commandBufferCount
+
+      _commandBuffers = global::device.allocateCommandBuffers( allocateInfo );
+      for ( const vk::CommandBuffer& commandBuffer : _commandBuffers )
+      {
+        VK_CORE_ASSERT( commandBuffer, "Failed to create command buffers." );
+      }
+
+      // Set up begin info.
+      _beginInfo.flags = usageFlags;
+    }
+
+    auto get( ) const -> const std::vector<vk::CommandBuffer> { return _commandBuffers; }
+
+    auto get( size_t index ) const -> const vk::CommandBuffer { return _commandBuffers[index]; }
+
+    auto getLevel( ) const -> vk::CommandBufferLevel { return _level; }
+
+    void free( )
+    {
+      global::device.freeCommandBuffers( _commandPool, static_cast<uint32_t>( _commandBuffers.size( ) ), _commandBuffers.data( ) );
+    }
+
+    void reset( )
+    {
+      for ( vk::CommandBuffer& buffer : _commandBuffers )
+      {
+        buffer.reset( vk::CommandBufferResetFlagBits::eReleaseResources );
+      }
+    }
+
+    /// Used to begin the command buffer recording.
+    /// @param index An index to a command buffer to record to.
+    /// @note Secondary command buffers require inheritance info. Use begin(size_t, const vk::CommandBufferInheritanceInfo&) instead.
+    void begin( size_t index = 0 )
+    {
+      VK_CORE_ASSERT( ( _level == vk::CommandBufferLevel::ePrimary ), "Secondary command buffers must be begun with inheritance info." );
+
+      _commandBuffers[index].begin( _beginInfo );
+    }
+
+    /// Used to begin the recording of a secondary command buffer.
+    /// @param index An index to a command buffer to record to.
+    /// @param inheritanceInfo Specifies the render pass, subpass and framebuffer the command buffer will be executed in. See RenderPass::getInheritanceInfo().
+    /// @note If a render pass is given, the command buffer is recorded with eRenderPassContinue.
+    void begin( size_t index, const vk::CommandBufferInheritanceInfo& inheritanceInfo )
+    {
+      VK_CORE_ASSERT( ( _level == vk::CommandBufferLevel::eSecondary ), "Inheritance info is only used by secondary command buffers." );
+
+      vk::CommandBufferBeginInfo beginInfo = _beginInfo;
+      beginInfo.pInheritanceInfo           = &inheritanceInfo;
+
+      if ( inheritanceInfo.renderPass )
+      {
+        beginInfo.flags |= vk::CommandBufferUsageFlagBits::eRenderPassContinue;
+      }
+
+      _commandBuffers[index].begin( beginInfo );
+    }
+
+    /// Used to stop the command buffer recording.
+    /// @param index An index to a command buffer to stop recording.
+    void end( size_t index = 0 )
+    {
+      _commandBuffers[index].end( );
+    }
+
+    /// Executes secondary command buffers from a primary command buffer.
+    /// @param index An index to the primary command buffer to record to.
+    /// @param secondaryCommandBuffers The recorded secondary command buffers.
+    /// @note If called inside a render pass, it must have been begun with vk::SubpassContents::eSecondaryCommandBuffers.
+    void execute( size_t index, const std::vector<vk::CommandBuffer>& secondaryCommandBuffers )
+    {
+      VK_CORE_ASSERT( ( _level == vk::CommandBufferLevel::ePrimary ), "Secondary command buffers can only be executed by primary command buffers." );
+
+      _commandBuffers[index].executeCommands( static_cast<uint32_t>( secondaryCommandBuffers.size( ) ), secondaryCommandBuffers.data( ) ); // CMD
+    }
+
+    /// Submits the recorded commands to a queue.
+    /// @param queue The queue to submit to.
+    /// @param waitSemaphores A std::vector of semaphores to wait for.
+    /// @param signalSemaphores A std::vector of semaphores to signal.
+    /// @param waitDstStageMask The pipeline stage where the commands will be executed.
+    /// @param wait If true, the function blocks until the submission has finished. Otherwise a fence is required to find out when it did.
+    void submitToQueue( vk::Queue queue, vk::Fence fence = nullptr, const std::vector<vk::Semaphore>& waitSemaphores = { }, const std::vector<vk::Semaphore>& signalSemaphores = { }, vk::PipelineStageFlags* waitDstStageMask = { }, bool wait = true )
+    {
+      VK_CORE_ASSERT( ( _level == vk::CommandBufferLevel::ePrimary ), "Only primary command buffers can be submitted." );
+      VK_CORE_ASSERT( ( wait || fence ), "A fence is required to submit without waiting." );
+
+      if ( _beginInfo.flags & vk::CommandBufferUsageFlagBits::eOneTimeSubmit )
+      {
+        vk::SubmitInfo submitInfo( static_cast<uint32_t>( waitSemaphores.size( ) ),   // waitSemaphoreCount
+                                   waitSemaphores.data( ),                            // pWaitSemaphores
+                                   waitDstStageMask,                                  // pWaitDstStageMask
+                                   static_cast<uint32_t>( _commandBuffers.size( ) ),  // commandBufferCount
+                                   _commandBuffers.data( ),                           // pCommandBuffers
+                                   static_cast<uint32_t>( signalSemaphores.size( ) ), // signalSemaphoreCount
+                                   signalSemaphores.data( ) );                        // pSignalSemaphores
+
+        // Wait for the given fence or a temporary one instead of the entire queue.
+        vk::UniqueFence temporaryFence;
+        if ( wait && !fence )
+        {
+          temporaryFence = initFenceUnique( { } );
+          fence          = temporaryFence.get( );
+        }
+
+        if ( queue.submit( 1, &submitInfo, fence ) != vk::Result::eSuccess )
+        {
+          VK_CORE_THROW( "Failed to submit" );
+        }
+
+        if ( wait )
+        {
+          vk::Result result = global::device.waitForFences( 1, &fence, VK_TRUE, UINT64_MAX );
+          VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to wait for fences." );
+        }
+      }
+      else
+      {
+        VK_CORE_THROW( "Only command buffers with a usage flag containing eOneTimeSubmit should be submitted automatically" );
+      }
+    }
+
+  private:
+    std::vector<vk::CommandBuffer> _commandBuffers;
+
+    vk::CommandPool _commandPool; ///< The command pool used to allocate the command buffer from.
+    vk::CommandBufferBeginInfo _beginInfo;
+    vk::CommandBufferLevel _level = vk::CommandBufferLevel::ePrimary;
+  };
+
+  /// Hands out command pools per thread and per frame, so command buffers can be recorded on multiple threads concurrently.
+  ///
+  /// Every thread receives its own pool for each frame on first use. All pools of a frame are reset at once using reset(), which recycles their command buffers.
+  /// @note A pool must only be used by the thread it was handed out to. reset() must not be called while any thread is still recording to the given frame.
+  /// @ingroup API
+  class CommandPoolManager
+  {
+  public:
+    CommandPoolManager( ) = default;
+
+    CommandPoolManager( const CommandPoolManager& )  = delete;
+    CommandPoolManager( const CommandPoolManager&& ) = delete;
+
+    auto operator=( const CommandPoolManager& ) -> CommandPoolManager& = delete;
+    auto operator=( const CommandPoolManager&& ) -> CommandPoolManager& = delete;
+
+    /// @return Returns the amount of frames that have their own pools.
+    auto getFrameCount( ) const -> uint32_t { return _frameCount; }
+
+    /// @return Returns the amount of threads that were handed out pools.
+    auto getThreadCount( ) -> size_t
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+      return _threads.size( );
+    }
+
+    /// Sets up the manager. Pools are created lazily.
+    /// @param queueFamilyIndex The queue family index the command buffers will be submitted to.
+    /// @param frameCount The amount of frames that may be recorded or in flight at the same time.
+    /// @param flags The flags every pool is created with.
+    void init( uint32_t queueFamilyIndex, uint32_t frameCount = global::dataCopies, vk::CommandPoolCreateFlags flags = vk::CommandPoolCreateFlagBits::eTransient )
+    {
+      destroy( );
+
+      _queueFamilyIndex = queueFamilyIndex;
+      _frameCount       = frameCount;
+      _flags            = flags;
+    }
+
+    /// Returns the calling thread's pool for the given frame.
+    /// @param frame The frame index in the range [0, getFrameCount()).
+    /// @return Returns the Vulkan command pool.
+    auto getPool( uint32_t frame ) -> vk::CommandPool
+    {
+      return getThreadPool( frame ).commandPool;
+    }
+
+    /// Allocates command buffers from the calling thread's pool for the given frame.
+    ///
+    /// Command buffers allocated during a previous use of the frame are handed out again instead of allocating new ones.
+    /// @param frame The frame index in the range [0, getFrameCount()).
+    /// @param count The amount of command buffers.
+    /// @param level Specifies if the command buffers are primary or secondary command buffers.
+    /// @return Returns the command buffers in the initial state. They are valid until reset() is called for the given frame.
+    auto allocate( uint32_t frame, uint32_t count = 1, vk::CommandBufferLevel level = vk::CommandBufferLevel::ePrimary ) -> std::vector<vk::CommandBuffer>
+    {
+      Pool& pool = getThreadPool( frame );
+
+      auto& commandBuffers = level == vk::CommandBufferLevel::ePrimary ? pool.primary : pool.secondary;
+      auto& used           = level == vk::CommandBufferLevel::ePrimary ? pool.usedPrimary : pool.usedSecondary;
+
+      if ( used + count > commandBuffers.size( ) )
+      {
+        vk::CommandBufferAllocateInfo allocateInfo( pool.commandPool,                                                 // commandPool
+                                                    level,                                                            // level
+                                                    static_cast<uint32_t>( used + count - commandBuffers.size( ) ) ); // commandBufferCount
+
+        for ( vk::CommandBuffer commandBuffer : global::device.allocateCommandBuffers( allocateInfo ) )
+        {
+          VK_CORE_ASSERT( commandBuffer, "Failed to create command buffers." );
+          commandBuffers.push_back( commandBuffer );
+        }
+      }
+
+      std::vector<vk::CommandBuffer> result( commandBuffers.begin( ) + used, commandBuffers.begin( ) + used + count );
+      used += count;
+
+      return result;
+    }
+
+    /// Resets the pools of all threads for the given frame using vkResetCommandPool.
+    /// @param frame The frame index in the range [0, getFrameCount()).
+    /// @note The device must have finished executing all command buffers allocated for the given frame.
+    void reset( uint32_t frame )
+    {
+      VK_CORE_ASSERT( ( frame < _frameCount ), "Frame index out of range." );
+
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      for ( auto& thread : _threads )
+      {
+        Pool& pool = thread.second[frame];
+        if ( pool.commandPool )
+        {
+          global::device.resetCommandPool( pool.commandPool, { } );
+        }
+
+        pool.usedPrimary   = 0;
+        pool.usedSecondary = 0;
+      }
+    }
+
+    /// Destroys all pools.
+    /// @note The device must have finished executing all command buffers allocated from the manager.
+    void destroy( )
+    {
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      for ( auto& thread : _threads )
+      {
+        for ( Pool& pool : thread.second )
+        {
+          if ( pool.commandPool )
+          {
+            global::device.destroyCommandPool( pool.commandPool );
+          }
+        }
+      }
+
+      _threads.clear( );
+    }
+
+  private:
+    struct Pool
+    {
+      vk::CommandPool commandPool = nullptr;
+      std::vector<vk::CommandBuffer> primary;   ///< All primary command buffers allocated from the pool.
+      std::vector<vk::CommandBuffer> secondary; ///< All secondary command buffers allocated from the pool.
+      size_t usedPrimary   = 0;                 ///< The amount of primary command buffers handed out since the last reset.
+      size_t usedSecondary = 0;                 ///< The amount of secondary command buffers handed out since the last reset.
+    };
+
+    auto getThreadPool( uint32_t frame ) -> Pool&
+    {
+      VK_CORE_ASSERT( ( frame < _frameCount ), "Frame index out of range." );
+
+      std::lock_guard<std::mutex> lock( _mutex );
+
+      // Map nodes are stable, so the reference remains valid when other threads add their pools.
+      auto& pools = _threads[std::this_thread::get_id( )];
+      if ( pools.empty( ) )
+      {
+        pools.resize( _frameCount );
+      }
+
+      Pool& pool = pools[frame];
+      if ( !pool.commandPool )
+      {
+        pool.commandPool = initCommandPool( _queueFamilyIndex, _flags );
+      }
+
+      return pool;
+    }
+
+    std::map<std::thread::id, std::vector<Pool>> _threads; ///< The pools of every thread, one per frame.
+
+    uint32_t _queueFamilyIndex = 0U;
+    uint32_t _frameCount       = 0U;
+    vk::CommandPoolCreateFlags _flags;
+
+    std::mutex _mutex;
+  };
+
+  /// Recycles command buffers used for single-time operations.
+  ///
+  /// Every queue family gets its own transient pool. Submitted command buffers are reset and handed out again once their fence was signaled.
+  /// @warning The pool is not thread-safe. Like the global queues it submits to, it must only be used by a single thread at a time.
+  /// @ingroup API
+  class TransientCommandPool
+  {
+  public:
+    TransientCommandPool( ) = default;
+
+    TransientCommandPool( const TransientCommandPool& )  = delete;
+    TransientCommandPool( const TransientCommandPool&& ) = delete;
+
+    auto operator=( const TransientCommandPool& ) -> TransientCommandPool& = delete;
+    auto operator=( const TransientCommandPool&& ) -> TransientCommandPool& = delete;
+
+    /// @return Returns the amount of command buffers that had to be allocated.
+    auto getAllocationCount( ) const -> uint64_t { return _allocationCount; }
+
+    /// @return Returns the amount of times a command buffer was recycled instead of allocating a new one.
+    auto getReuseCount( ) const -> uint64_t { return _reuseCount; }
+
+    /// Returns a command buffer in the recording state.
+    /// @param queueFamilyIndex The queue family index of the queue the command buffer will be submitted to.
+    /// @return Returns the Vulkan command buffer.
+    auto begin( uint32_t queueFamilyIndex ) -> vk::CommandBuffer
+    {
+      Family& family = _families[queueFamilyIndex];
+      if ( !family.commandPool )
+      {
+        family.commandPool = initCommandPool( queueFamilyIndex, vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer );
+      }
+
+      collect( family );
+
+      Entry entry;
+      if ( !family.free.empty( ) )
+      {
+        entry = std::move( family.free.back( ) );
+        family.free.pop_back( );
+
+        ++_reuseCount;
+      }
+      else
+      {
+        vk::CommandBufferAllocateInfo allocateInfo( family.commandPool,               // commandPool
+                                                    vk::CommandBufferLevel::ePrimary, // level
+                                                    1U );                             // commandBufferCount
+
+        entry.commandBuffer = global::device.allocateCommandBuffers( allocateInfo ).front( );
+        VK_CORE_ASSERT( entry.commandBuffer, "Failed to create command buffers." );
+
+        entry.fence = initFenceUnique( { } );
+
+        ++_allocationCount;
+      }
+
+      entry.commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+
+      vk::CommandBuffer commandBuffer = entry.commandBuffer;
+      family.recording.push_back( std::move( entry ) );
+
+      return commandBuffer;
+    }
+
+    /// Ends the recording of a command buffer returned by begin() and submits it.
+    /// @param commandBuffer The command buffer to submit.
+    /// @param queue The queue to submit to. Must belong to the queue family passed to begin().
+    /// @param wait If true, the function blocks until the command buffer has finished executing.
+    /// @param fence A fence that is signaled once the command buffer has finished executing.
+    void submit( vk::CommandBuffer commandBuffer, vk::Queue queue, bool wait = true, vk::Fence fence = nullptr )
+    {
+      Family* family = nullptr;
+      Entry entry;
+
+      for ( auto& it : _families )
+      {
+        auto recording = std::find_if( it.second.recording.begin( ), it.second.recording.end( ), [&]( const Entry& candidate ) { return candidate.commandBuffer == commandBuffer; } );
+        if ( recording != it.second.recording.end( ) )
+        {
+          family = &it.second;
+          entry  = std::move( *recording );
+          it.second.recording.erase( recording );
+          break;
+        }
+      }
+
+      VK_CORE_ASSERT( ( family != nullptr ), "The command buffer was not returned by the transient command pool." );
+
+      commandBuffer.end( );
+
+      if ( fence )
+      {
+        submitCommandBuffer( queue, commandBuffer, fence );
+
+        // An empty submission signals the pool's own fence once the command buffer has finished executing, so it can be recycled.
+        if ( queue.submit( 0, nullptr, entry.fence.get( ) ) != vk::Result::eSuccess )
+        {
+          VK_CORE_THROW( "Failed to submit" );
+        }
+      }
+      else
+      {
+        submitCommandBuffer( queue, commandBuffer, entry.fence.get( ) );
+      }
+
+      vk::Fence entryFence = entry.fence.get( );
+      family->pending.push_back( std::move( entry ) );
+
+      if ( wait )
+      {
+        vk::Result result = global::device.waitForFences( 1, &entryFence, VK_TRUE, UINT64_MAX );
+        VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to wait for fences." );
+      }
+    }
+
+    /// Waits for all pending command buffers and destroys all pools.
+    void destroy( )
+    {
+      for ( auto& it : _families )
+      {
+        for ( Entry& entry : it.second.pending )
+        {
+          vk::Fence fence = entry.fence.get( );
+          vk::Result result = global::device.waitForFences( 1, &fence, VK_TRUE, UINT64_MAX );
+          VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to wait for fences." );
+        }
+
+        it.second.free.clear( );
+        it.second.pending.clear( );
+        it.second.recording.clear( );
+
+        if ( it.second.commandPool )
+        {
+          global::device.destroyCommandPool( it.second.commandPool );
+        }
+      }
+
+      _families.clear( );
+    }
+
+  private:
+    struct Entry
+    {
+      vk::CommandBuffer commandBuffer = nullptr;
+      vk::UniqueFence fence; ///< Signaled once the command buffer has finished executing.
+    };
+
+    struct Family
+    {
+      vk::CommandPool commandPool = nullptr;
+      std::vector<Entry> free;      ///< Command buffers ready to be reused.
+      std::vector<Entry> recording; ///< Command buffers currently being recorded.
+      std::deque<Entry> pending;    ///< Submitted command buffers, oldest first.
+    };
+
+    /// Recycles all pending command buffers of a queue family that have finished executing.
+    void collect( Family& family )
+    {
+      while ( !family.pending.empty( ) )
+      {
+        Entry& entry = family.pending.front( );
+        if ( global::device.getFenceStatus( entry.fence.get( ) ) != vk::Result::eSuccess )
+        {
+          break;
+        }
+
+        vk::Fence fence = entry.fence.get( );
+        vk::Result result = global::device.resetFences( 1, &fence );
+        VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to reset fences." );
+
+        entry.commandBuffer.reset( { } );
+
+        family.free.push_back( std::move( entry ) );
+        family.pending.pop_front( );
+      }
+    }
+
+    std::map<uint32_t, Family> _families; ///< The pools and command buffers of each queue family.
+
+    uint64_t _allocationCount = 0U;
+    uint64_t _reuseCount      = 0U;
+  };
+
+  namespace global
+  {
+    inline TransientCommandPool transientCommandPool; ///< Provides the command buffers for all single-time operations of vkCore resources.
+  } // namespace global
+
+  class Image;
+  class TransferFuture;
+
+  /// Tracks the current layout, accesses and pipeline stages of images and buffers and computes the barriers required to use them.
+  ///
+  /// Call image() or buffer() for every resource the next command uses and flush() right before recording it. All pending barriers are recorded using a single vkCmdPipelineBarrier.
+  /// Barriers are only added if necessary. Reads following reads do not need any barrier, while writes following reads only need an execution dependency.
+  /// vkCore::Image tracks the layout of each of its subresources itself. Pass it to image(Image&, vk::ImageLayout, const vk::ImageSubresourceRange*) instead of its Vulkan handle, so there is only a single layout per subresource.
+  /// @note Vulkan images are tracked as a whole. The tracker must only be used on a single thread.
+  /// @ingroup API
+  class StateTracker
+  {
+  public:
+    /// @return Returns the tracked layout of an image or vk::ImageLayout::eUndefined if the image is unknown.
+    auto getLayout( vk::Image image ) const -> vk::ImageLayout
+    {
+      auto it = _images.find( image );
+      return it != _images.end( ) ? it->second.layout : vk::ImageLayout::eUndefined;
+    }
+
+    /// @return Returns true if barriers are waiting to be recorded.
+    auto hasPendingBarriers( ) const -> bool { return static_cast<bool>( _dstStageMask ); }
+
+    /// Sets the state of an image without adding a barrier, e.g. for images transitioned elsewhere.
+    /// @param image The Vulkan image.
+    /// @param layout The image's current layout.
+    /// @param access The memory accesses of the image's last use.
+    /// @param stages The pipeline stages of the image's last use.
+    void setState( vk::Image image, vk::ImageLayout layout, vk::AccessFlags access, vk::PipelineStageFlags stages )
+    {
+      _images[image] = { { access, stages }, layout, { } };
+    }
+
+    /// Sets the state of a buffer without adding a barrier.
+    /// @param buffer The Vulkan buffer.
+    /// @param access The memory accesses of the buffer's last use.
+    /// @param stages The pipeline stages of the buffer's last use.
+    void setState( vk::Buffer buffer, vk::AccessFlags access, vk::PipelineStageFlags stages )
+    {
+      _buffers[buffer] = { { access, stages }, { } };
+    }
+
+    /// Requests an image to be in the given layout for the next command, using the accesses and stages typical for the layout.
+    /// @param image The Vulkan image.
+    /// @param layout The layout the next command expects.
+    /// @param subresourceRange The range the barrier covers.
+    void image( vk::Image image, vk::ImageLayout layout, const vk::ImageSubresourceRange& subresourceRange = { vk::ImageAspectFlagBits::eColor, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS } )
+    {
+      auto info = getLayoutAccessInfo( layout );
+      this->image( image, layout, info.first, info.second, subresourceRange );
+    }
+
+    /// Requests an image to be in the given state for the next command.
+    /// @param image The Vulkan image.
+    /// @param layout The layout the next command expects.
+    /// @param access The memory accesses of the next command.
+    /// @param stages The pipeline stages the next command accesses the image in.
+    /// @param subresourceRange The range the barrier covers.
+    void image( vk::Image image, vk::ImageLayout layout, vk::AccessFlags access, vk::PipelineStageFlags stages, const vk::ImageSubresourceRange& subresourceRange = { vk::ImageAspectFlagBits::eColor, 0, VK_REMAINING_MIP_LEVELS, 0, VK_REMAINING_ARRAY_LAYERS } )
+    {
+      ImageState& state = _images[image];
+
+      // Another request for the same command. Merge it into the pending barrier.
+      if ( state.pending.has_value( ) )
+      {
+        vk::ImageMemoryBarrier& barrier = _imageBarriers[state.pending.value( )];
+        barrier.newLayout               = layout;
+        barrier.dstAccessMask |= access;
+
+        _imageBarrierStages[state.pending.value( )].second |= stages;
+
+        _dstStageMask |= stages;
+        state.layout = layout;
+        state.use.access |= access;
+        state.use.stages |= stages;
+        return;
+      }
+
+      if ( state.layout == layout && !requiresMemoryBarrier( state.use ) )
+      {
+        addExecutionDependency( state.use, access, stages );
+        return;
+      }
+
+      vk::ImageMemoryBarrier barrier( getWriteAccess( state.use.access ), // srcAccessMask
+                                      access,                             // dstAccessMask
+                                      state.layout,                       // oldLayout
+                                      layout,                             // newLayout
+                                      VK_QUEUE_FAMILY_IGNORED,            // srcQueueFamilyIndex
+                                      VK_QUEUE_FAMILY_IGNORED,            // dstQueueFamilyIndex
+                                      image,                              // image
+                                      subresourceRange );                 // subresourceRange
+
+      _srcStageMask |= state.use.stages;
+      _dstStageMask |= stages;
+
+      _imageBarrierStages.emplace_back( state.use.stages, stages );
+
+      state.pending = _imageBarriers.size( );
+      state.layout  = layout;
+      state.use     = { access, stages };
+
+      _imageBarriers.push_back( barrier );
+      _pendingImages.push_back( image );
+    }
+
+    /// Requests the subresources of a vkCore::Image to be in the given layout for the next command, using the accesses and stages typical for the layouts.
+    ///
+    /// The image's tracked layouts are updated right away. Subresources that already are in the target layout are skipped.
+    /// @param image The image.
+    /// @param layout The layout the next command expects.
+    /// @param subresourceRange Optionally used to define a non-standard subresource range. If omitted, the entire image is transitioned.
+    void image( Image& image, vk::ImageLayout layout, const vk::ImageSubresourceRange* subresourceRange = nullptr );
+
+    /// Requests a buffer to be in the given state for the next command.
+    /// @param buffer The Vulkan buffer.
+    /// @param access The memory accesses of the next command.
+    /// @param stages The pipeline stages the next command accesses the buffer in.
+    void buffer( vk::Buffer buffer, vk::AccessFlags access, vk::PipelineStageFlags stages )
+    {
+      BufferState& state = _buffers[buffer];
+
+      if ( state.pending.has_value( ) )
+      {
+        _bufferBarriers[state.pending.value( )].dstAccessMask |= access;
+        _bufferBarrierStages[state.pending.value( )].second |= stages;
+
+        _dstStageMask |= stages;
+        state.use.access |= access;
+        state.use.stages |= stages;
+        return;
+      }
+
+      if ( !requiresMemoryBarrier( state.use ) )
+      {
+        addExecutionDependency( state.use, access, stages );
+        return;
+      }
+
+      vk::BufferMemoryBarrier barrier( getWriteAccess( state.use.access ), // srcAccessMask
+                                       access,                             // dstAccessMask
+                                       VK_QUEUE_FAMILY_IGNORED,            // srcQueueFamilyIndex
+                                       VK_QUEUE_FAMILY_IGNORED,            // dstQueueFamilyIndex
+                                       buffer,                             // buffer
+                                       0,                                  // offset
+                                       VK_WHOLE_SIZE );                    // size
+
+      _srcStageMask |= state.use.stages;
+      _dstStageMask |= stages;
+
+      _bufferBarrierStages.emplace_back( state.use.stages, stages );
+
+      state.pending = _bufferBarriers.size( );
+      state.use     = { access, stages };
+
+      _bufferBarriers.push_back( barrier );
+      _pendingBuffers.push_back( buffer );
+    }
+
+    /// Records all pending barriers using a single pipeline barrier.
+    ///
+    /// If VK_KHR_synchronization2 is enabled, every barrier only waits for the stages of its own resource. Otherwise, all barriers share the union of all stages.
+    /// @param commandBuffer The command buffer to record to. It must be in the recording state.
+    /// @param srcTransferCommands The transfer commands the barriers wait for.
+    /// @param dstTransferCommands The transfer commands waiting for the barriers.
+    void flush( vk::CommandBuffer commandBuffer, TransferCommandFlags srcTransferCommands = TransferCommandBits::eAll, TransferCommandFlags dstTransferCommands = TransferCommandBits::eAll )
+    {
+      if ( !hasPendingBarriers( ) )
+      {
+        return;
+      }
+
+      if ( !_srcStageMask )
+      {
+        _srcStageMask = vk::PipelineStageFlagBits::eTopOfPipe;
+      }
+
+#ifdef VK_KHR_synchronization2
+      if ( global::synchronization2 )
+      {
+        std::vector<vk::ImageMemoryBarrier2KHR> imageBarriers;
+        imageBarriers.reserve( _imageBarriers.size( ) );
+
+        for ( size_t i = 0; i < _imageBarriers.size( ); ++i )
+        {
+          imageBarriers.push_back( getImageMemoryBarrier2( _imageBarriers[i], _imageBarrierStages[i].first, _imageBarrierStages[i].second, srcTransferCommands, dstTransferCommands ) );
+        }
+
+        std::vector<vk::BufferMemoryBarrier2KHR> bufferBarriers;
+        bufferBarriers.reserve( _bufferBarriers.size( ) );
+
+        for ( size_t i = 0; i < _bufferBarriers.size( ); ++i )
+        {
+          bufferBarriers.push_back( getBufferMemoryBarrier2( _bufferBarriers[i], _bufferBarrierStages[i].first, _bufferBarrierStages[i].second, srcTransferCommands, dstTransferCommands ) );
+        }
+
+        // Writes after reads only need an execution dependency.
+        vk::MemoryBarrier2KHR executionBarrier( getPipelineStageFlags2( _executionSrcStageMask, srcTransferCommands ), // srcStageMask
+                                                { },                                                                   // srcAccessMask
+                                                getPipelineStageFlags2( _executionDstStageMask, dstTransferCommands ), // dstStageMask
+                                                { } );                                                                 // dstAccessMask
+
+        vk::DependencyInfoKHR dependencyInfo;
+        dependencyInfo.memoryBarrierCount       = _executionDstStageMask ? 1 : 0;
+        dependencyInfo.pMemoryBarriers          = &executionBarrier;
+        dependencyInfo.bufferMemoryBarrierCount = static_cast<uint32_t>( bufferBarriers.size( ) );
+        dependencyInfo.pBufferMemoryBarriers    = bufferBarriers.data( );
+        dependencyInfo.imageMemoryBarrierCount  = static_cast<uint32_t>( imageBarriers.size( ) );
+        dependencyInfo.pImageMemoryBarriers     = imageBarriers.data( );
+
+        commandBuffer.pipelineBarrier2KHR( dependencyInfo ); // CMD
+      }
+      else
+#endif
+      {
+        commandBuffer.pipelineBarrier( _srcStageMask,                                    // srcStageMask
+                                       _dstStageMask,                                    // dstStageMask
+                                       { },                                              // dependencyFlags
+                                       0,                                                // memoryBarrierCount
+                                       nullptr,                                          // pMemoryBarriers
+                                       static_cast<uint32_t>( _bufferBarriers.size( ) ), // bufferMemoryBarrierCount
+                                       _bufferBarriers.data( ),                          // pBufferMemoryBarriers
+                                       static_cast<uint32_t>( _imageBarriers.size( ) ),  // imageMemoryBarrierCount
+                                       _imageBarriers.data( ) );                         // pImageMemoryBarriers
+      }
+
+      for ( vk::Image image : _pendingImages )
+      {
+        if ( auto it = _images.find( image ); it != _images.end( ) )
+        {
+          it->second.pending.reset( );
+        }
+      }
+
+      for ( vk::Buffer buffer : _pendingBuffers )
+      {
+        if ( auto it = _buffers.find( buffer ); it != _buffers.end( ) )
+        {
+          it->second.pending.reset( );
+        }
+      }
+
+      clearBarriers( );
+    }
+
+    /// Stops tracking an image, e.g. because it is about to be destroyed.
+    void forget( vk::Image image )
+    {
+      _images.erase( image );
+    }
+
+    /// Stops tracking a buffer, e.g. because it is about to be destroyed.
+    void forget( vk::Buffer buffer )
+    {
+      _buffers.erase( buffer );
+    }
+
+    /// Stops tracking all resources and discards pending barriers.
+    void clear( )
+    {
+      _images.clear( );
+      _buffers.clear( );
+
+      clearBarriers( );
+    }
+
+  private:
+    struct Use
+    {
+      vk::AccessFlags access;
+      vk::PipelineStageFlags stages = vk::PipelineStageFlagBits::eTopOfPipe;
+    };
+
+    struct ImageState
+    {
+      Use use;
+      vk::ImageLayout layout = vk::ImageLayout::eUndefined;
+      std::optional<size_t> pending; ///< The index of the image's barrier that has not been recorded yet.
+    };
+
+    struct BufferState
+    {
+      Use use;
+      std::optional<size_t> pending; ///< The index of the buffer's barrier that has not been recorded yet.
+    };
+
+    /// @return Returns true if the previous use wrote to the resource, so its writes must be made visible to the next use.
+    static auto requiresMemoryBarrier( const Use& previous ) -> bool
+    {
+      return static_cast<bool>( getWriteAccess( previous.access ) );
+    }
+
+    /// Handles accesses that do not need a memory barrier: Reads after reads are merged into the previous use, writes after reads only wait for the reads to finish.
+    void addExecutionDependency( Use& previous, vk::AccessFlags access, vk::PipelineStageFlags stages )
+    {
+      if ( getWriteAccess( access ) )
+      {
+        _srcStageMask |= previous.stages;
+        _dstStageMask |= stages;
+
+        _executionSrcStageMask |= previous.stages;
+        _executionDstStageMask |= stages;
+
+        previous = { access, stages };
+      }
+      else
+      {
+        previous.access |= access;
+        previous.stages |= stages;
+      }
+    }
+
+    void clearBarriers( )
+    {
+      _imageBarriers.clear( );
+      _bufferBarriers.clear( );
+      _pendingImages.clear( );
+      _pendingBuffers.clear( );
+      _imageBarrierStages.clear( );
+      _bufferBarrierStages.clear( );
+
+      _srcStageMask          = { };
+      _dstStageMask          = { };
+      _executionSrcStageMask = { };
+      _executionDstStageMask = { };
+    }
+
+    std::map<vk::Image, ImageState> _images;
+    std::map<vk::Buffer, BufferState> _buffers;
+
+    std::vector<vk::ImageMemoryBarrier> _imageBarriers;
+    std::vector<vk::BufferMemoryBarrier> _bufferBarriers;
+    std::vector<vk::Image> _pendingImages;   ///< The images with a barrier that has not been recorded yet.
+    std::vector<vk::Buffer> _pendingBuffers; ///< The buffers with a barrier that has not been recorded yet.
+    std::vector<std::pair<vk::PipelineStageFlags, vk::PipelineStageFlags>> _imageBarrierStages;  ///< The source and destination stages of each image barrier.
+    std::vector<std::pair<vk::PipelineStageFlags, vk::PipelineStageFlags>> _bufferBarrierStages; ///< The source and destination stages of each buffer barrier.
+
+    vk::PipelineStageFlags _srcStageMask;          ///< The union of all source stages.
+    vk::PipelineStageFlags _dstStageMask;          ///< The union of all destination stages.
+    vk::PipelineStageFlags _executionSrcStageMask; ///< The source stages of dependencies without memory barriers.
+    vk::PipelineStageFlags _executionDstStageMask; ///< The destination stages of dependencies without memory barriers.
+  };
+
+  /// A wrapper class for a Vulkan image.
+  /// @ingroup API
+  class Image
+  {
+  public:
+    Image( ) = default;
+
+    Image( const Image& ) = delete;
+    Image( Image&& )      = default;
+
+    auto operator=( const Image& ) -> Image& = delete;
+
+    /// Hands the image and its memory to global::deletionQueue if it is enabled and takes over those of another image.
+    /// @param image The image to move from.
+    auto operator=( Image&& image ) -> Image&
+    {
+      if ( this != &image )
+      {
+        global::deletionQueue.push( _image, _memory );
+
+        _image       = std::move( image._image );
+        _memory      = std::move( image._memory );
+        _extent      = image._extent;
+        _format      = image._format;
+        _aspectMask  = image._aspectMask;
+        _mipLevels   = image._mipLevels;
+        _arrayLayers = image._arrayLayers;
+        _layouts     = std::move( image._layouts );
+      }
+
+      return *this;
+    }
+
+    /// Hands the image and its memory to global::deletionQueue if it is enabled.
+    ~Image( )
+    {
+      global::deletionQueue.push( _image, _memory );
+    }
+
+    auto get( ) const -> vk::Image { return _image.get( ); }
+
+    auto getExtent( ) const -> vk::Extent3D { return _extent; }
+
+    auto getFormat( ) const -> vk::Format { return _format; }
+
+    auto getMipLevels( ) const -> uint32_t { return _mipLevels; }
+
+    auto getArrayLayers( ) const -> uint32_t { return _arrayLayers; }
+
+    /// @return Returns the layout of the first mip level of the first array layer.
+    auto getLayout( ) const -> vk::ImageLayout { return getLayout( 0, 0 ); }
+
+    /// @param mipLevel The subresource's mip level.
+    /// @param arrayLayer The subresource's array layer.
+    /// @return Returns the tracked layout of a single subresource.
+    auto getLayout( uint32_t mipLevel, uint32_t arrayLayer ) const -> vk::ImageLayout
+    {
+      return _layouts.empty( ) ? vk::ImageLayout::eUndefined : _layouts[arrayLayer * _mipLevels + mipLevel];
+    }
+
+    /// Creates the image and allocates memory for it.
+    /// @param createInfo The Vulkan image create info.
+    /// @param dedicated If true, the image will receive its own Vulkan device memory instead of being sub-allocated.
+    void init( const vk::ImageCreateInfo& createInfo, bool dedicated = false )
+    {
+      _extent      = createInfo.extent;
+      _format      = createInfo.format;
+      _mipLevels   = createInfo.mipLevels;
+      _arrayLayers = createInfo.arrayLayers;
+      _aspectMask  = getImageAspectFlags( createInfo.format );
+
+      // The layout is tracked for every mip level of every array layer.
+      _layouts.assign( static_cast<size_t>( _mipLevels ) * _arrayLayers, createInfo.initialLayout );
+
+      // Defer the destruction of a previously created image.
+      global::deletionQueue.push( _image, _memory );
+
+      _image = global::device.createImageUnique( createInfo );
+      VK_CORE_ASSERT( _image.get( ), "Failed to create image" );
+      _memory = allocateUnique( _image.get( ), vk::MemoryPropertyFlagBits::eDeviceLocal, dedicated, nullptr, createInfo.tiling == vk::ImageTiling::eLinear );
+      global::device.bindImageMemory( _image.get( ), _memory.get( ).memory, _memory.get( ).offset );
+    }
+
+    /// Used to transition this image's layout.
+    /// @param layout The target layout.
+    /// @param subresourceRange Optionally used to define a non-standard subresource range. If omitted, the entire image is transitioned.
+    /// @note This function uses a single-time usage command buffer of global::transientCommandPool. Nothing is submitted if all subresources already are in the target layout.
+    void transitionToLayout( vk::ImageLayout layout, const vk::ImageSubresourceRange* subresourceRange = nullptr )
+    {
+      StateTracker tracker;
+      tracker.image( *this, layout, subresourceRange );
+
+      if ( !tracker.hasPendingBarriers( ) )
+      {
+        return;
+      }
+
+      vk::CommandBuffer commandBuffer = global::transientCommandPool.begin( global::graphicsFamilyIndex );
+
+      tracker.flush( commandBuffer );
+
+      global::transientCommandPool.submit( commandBuffer, global::graphicsQueue );
+    }
+
+    /// Used to transition this image's layout using an already existing command buffer.
+    ///
+    /// Subresources that already are in the target layout are skipped. Adjacent subresources sharing the same layout are merged into a single barrier.
+    /// @param layout The target layout
+    /// @param commandBuffer The command buffer that will be used to set up a pipeline barrier.
+    /// @param subresourceRange Optionally used to define a non-standard subresource range. If omitted, the entire image is transitioned.
+    void transitionToLayout( vk::ImageLayout layout, vk::CommandBuffer commandBuffer, const vk::ImageSubresourceRange* subresourceRange = nullptr )
+    {
+      StateTracker tracker;
+      tracker.image( *this, layout, subresourceRange );
+      tracker.flush( commandBuffer );
+    }
+
+    /// Updates the tracked layout without recording a barrier, e.g. if the layout was changed by a render pass.
+    /// @param layout The subresources' new layout.
+    /// @param subresourceRange Optionally used to define a non-standard subresource range. If omitted, the entire image is affected.
+    void setLayout( vk::ImageLayout layout, const vk::ImageSubresourceRange* subresourceRange = nullptr )
+    {
+      vk::ImageSubresourceRange range = resolveSubresourceRange( subresourceRange );
+
+      for ( uint32_t layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount; ++layer )
+      {
+        for ( uint32_t mip = range.baseMipLevel; mip < range.baseMipLevel + range.levelCount; ++mip )
+        {
+          _layouts[layer * _mipLevels + mip] = layout;
+        }
+      }
+    }
+
+    /// Generates the image's mip chain from its first mip level using a chain of blits.
+    ///
+    /// Every mip level is blitted from the previous one. Linear filtering is used if the format supports it, nearest filtering otherwise.
+    /// @param commandBuffer The command buffer the blits will be recorded to. It must belong to a queue family supporting graphics operations.
+    /// @param finalLayout The layout all mip levels will be transitioned to in a single batch once the chain has been generated.
+    /// @note The first mip level must already contain the image's data and the image must have been created with both transfer source and destination usage.
+    void generateMipmaps( vk::CommandBuffer commandBuffer, vk::ImageLayout finalLayout = vk::ImageLayout::eShaderReadOnlyOptimal )
+    {
+      vk::FormatFeatureFlags features = global::physicalDevice.getFormatProperties( _format ).optimalTilingFeatures;
+      VK_CORE_ASSERT( ( features & vk::FormatFeatureFlagBits::eBlitSrc ) && ( features & vk::FormatFeatureFlagBits::eBlitDst ), "Image format does not support blitting." );
+
+      vk::Filter filter = ( features & vk::FormatFeatureFlagBits::eSampledImageFilterLinear ) ? vk::Filter::eLinear : vk::Filter::eNearest;
+
+      StateTracker tracker;
+
+      auto width  = static_cast<int32_t>( _extent.width );
+      auto height = static_cast<int32_t>( _extent.height );
+      auto depth  = static_cast<int32_t>( _extent.depth );
+
+      for ( uint32_t mip = 1; mip < _mipLevels; ++mip )
+      {
+        vk::ImageSubresourceRange srcRange( _aspectMask, mip - 1, 1, 0, _arrayLayers );
+        vk::ImageSubresourceRange dstRange( _aspectMask, mip, 1, 0, _arrayLayers );
+
+        // Both barriers are recorded with a single call.
+        tracker.image( *this, vk::ImageLayout::eTransferSrcOptimal, &srcRange );
+        tracker.image( *this, vk::ImageLayout::eTransferDstOptimal, &dstRange );
+
+        // Only the first level might have been written by other commands than the blits.
+        tracker.flush( commandBuffer, mip == 1 ? TransferCommandBits::eAll : TransferCommandBits::eBlit, TransferCommandBits::eBlit );
+
+        int32_t mipWidth  = std::max( width / 2, 1 );
+        int32_t mipHeight = std::max( height / 2, 1 );
+        int32_t mipDepth  = std::max( depth / 2, 1 );
+
+        vk::ImageBlit blit( { _aspectMask, mip - 1, 0, _arrayLayers },                                      // srcSubresource
+                            { vk::Offset3D { 0, 0, 0 }, vk::Offset3D { width, height, depth } },            // srcOffsets
+                            { _aspectMask, mip, 0, _arrayLayers },                                          // dstSubresource
+                            { vk::Offset3D { 0, 0, 0 }, vk::Offset3D { mipWidth, mipHeight, mipDepth } } ); // dstOffsets
+
+        commandBuffer.blitImage( _image.get( ), vk::ImageLayout::eTransferSrcOptimal, _image.get( ), vk::ImageLayout::eTransferDstOptimal, 1, &blit, filter ); // CMD
+
+        width  = mipWidth;
+        height = mipHeight;
+        depth  = mipDepth;
+      }
+
+      // All but the last mip level are transfer sources now, so this results in at most two barriers recorded at once.
+      transitionToLayout( finalLayout, commandBuffer );
+    }
+
+  protected:
+    friend class StateTracker;
+
+    /// Replaces VK_REMAINING_MIP_LEVELS and VK_REMAINING_ARRAY_LAYERS with actual counts.
+    /// @param subresourceRange The range to resolve or nullptr for the entire image.
+    /// @return Returns the resolved range.
+    auto resolveSubresourceRange( const vk::ImageSubresourceRange* subresourceRange ) const -> vk::ImageSubresourceRange
+    {
+      vk::ImageSubresourceRange range( _aspectMask, 0, _mipLevels, 0, _arrayLayers );
+
+      if ( subresourceRange != nullptr )
+      {
+        range = *subresourceRange;
+
+        if ( range.levelCount == VK_REMAINING_MIP_LEVELS )
+        {
+          range.levelCount = _mipLevels - range.baseMipLevel;
+        }
+
+        if ( range.layerCount == VK_REMAINING_ARRAY_LAYERS )
+        {
+          range.layerCount = _arrayLayers - range.baseArrayLayer;
+        }
+      }
+
+      VK_CORE_ASSERT( ( range.baseMipLevel + range.levelCount <= _mipLevels && range.baseArrayLayer + range.layerCount <= _arrayLayers ), "Subresource range exceeds the image." );
+
+      return range;
+    }
+
+    /// Computes the transitions required to bring a range of subresources into the given layout and updates the tracked layouts.
+    ///
+    /// Within each array layer, consecutive mip levels sharing the same layout form a single region. Regions covering the same mip levels of adjacent array layers are merged.
+    /// @param layout The target layout.
+    /// @param subresourceRange The range to transition or nullptr for the entire image.
+    /// @return Returns the transitions.
+    auto getTransitions( vk::ImageLayout layout, const vk::ImageSubresourceRange* subresourceRange ) -> std::vector<ImageTransition>
+    {
+      vk::ImageSubresourceRange range = resolveSubresourceRange( subresourceRange );
+
+      std::vector<ImageTransition> transitions;
+      std::vector<size_t> previousLayer; // The transitions ending at the previous array layer.
+
+      for ( uint32_t layer = range.baseArrayLayer; layer < range.baseArrayLayer + range.layerCount; ++layer )
+      {
+        std::vector<size_t> currentLayer;
+
+        uint32_t mip = range.baseMipLevel;
+        while ( mip < range.baseMipLevel + range.levelCount )
+        {
+          vk::ImageLayout oldLayout = _layouts[layer * _mipLevels + mip];
+
+          uint32_t end = mip + 1;
+          while ( end < range.baseMipLevel + range.levelCount && _layouts[layer * _mipLevels + end] == oldLayout )
+          {
+            ++end;
+          }
+
+          if ( oldLayout != layout )
+          {
+            vk::ImageSubresourceRange region( range.aspectMask, mip, end - mip, layer, 1 );
+
+            // Extend the transition of the previous array layer if it covers the same mip levels.
+            auto it = std::find_if( previousLayer.begin( ), previousLayer.end( ), [&]( size_t index ) {
+              const ImageTransition& candidate = transitions[index];
+              return candidate.oldLayout == oldLayout && candidate.subresourceRange->baseMipLevel == mip && candidate.subresourceRange->levelCount == end - mip;
+            } );
+
+            if ( it != previousLayer.end( ) )
+            {
+              ++transitions[*it].subresourceRange->layerCount;
+              currentLayer.push_back( *it );
+            }
+            else
+            {
+              currentLayer.push_back( transitions.size( ) );
+              transitions.push_back( { _image.get( ), oldLayout, layout, region } );
+            }
+
+            for ( uint32_t i = mip; i < end; ++i )
+            {
+              _layouts[layer * _mipLevels + i] = layout;
+            }
+          }
+
+          mip = end;
+        }
+
+        previousLayer = std::move( currentLayer );
+      }
+
+      return transitions;
+    }
+
+    vk::UniqueImage _image;
+    UniqueAllocation _memory;
+
+    vk::Extent3D _extent;
+    vk::Format _format;
+    vk::ImageAspectFlags _aspectMask = vk::ImageAspectFlagBits::eColor;
+    uint32_t _mipLevels              = 1U;
+    uint32_t _arrayLayers            = 1U;
+
+    std::vector<vk::ImageLayout> _layouts; ///< The layout of every subresource, indexed by array layer * mip levels + mip level.
+  };
+
+  inline void StateTracker::image( Image& image, vk::ImageLayout layout, const vk::ImageSubresourceRange* subresourceRange )
+  {
+    for ( const ImageTransition& transition : image.getTransitions( layout, subresourceRange ) )
+    {
+      auto barrierInfo = getImageMemoryBarrierInfo( transition.image, transition.oldLayout, transition.newLayout, &transition.subresourceRange.value( ) );
+
+      _srcStageMask |= std::get<1>( barrierInfo );
+      _dstStageMask |= std::get<2>( barrierInfo );
+
+      _imageBarriers.push_back( std::get<0>( barrierInfo ) );
+      _imageBarrierStages.emplace_back( std::get<1>( barrierInfo ), std::get<2>( barrierInfo ) );
+    }
+  }
+
+  /// A wrapper class for a Vulkan buffer object.
+  /// @ingroup API
+  class Buffer
+  {
+  public:
+    Buffer( ) = default;
+
+    /// Call to init(k::DeviceSize, vk::BufferUsageFlags, const std::vector<uint32_t>&, vk::MemoryPropertyFlags, void*, bool, vk::MemoryPropertyFlags).
+    Buffer( vk::DeviceSize size, vk::BufferUsageFlags usage, const std::vector<uint32_t>& queueFamilyIndices = { }, vk::MemoryPropertyFlags memoryPropertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal, void* pNextMemory = nullptr, bool dedicated = false, vk::MemoryPropertyFlags preferredMemoryPropertyFlags = { } )
+    {
+      init( size, usage, queueFamilyIndices, memoryPropertyFlags, pNextMemory, dedicated, preferredMemoryPropertyFlags );
+    }
+
+#ifdef VK_EXT_external_memory_host
+    /// Call to init(void*, vk::DeviceSize, vk::BufferUsageFlags, const std::vector<uint32_t>&).
+    Buffer( void* hostPointer, vk::DeviceSize size, vk::BufferUsageFlags usage, const std::vector<uint32_t>& queueFamilyIndices = { } )
+    {
+      init( hostPointer, size, usage, queueFamilyIndices );
+    }
+#endif
+
+    /// @param buffer The target for the copy operation.
+    Buffer( const Buffer& buffer )
+    {
+      copyToBuffer( buffer );
+    }
+
+    Buffer( const Buffer&& ) = delete;
+
+    /// Call to copyToBuffer(Buffer).
+    auto operator=( const Buffer& buffer ) -> Buffer&
+    {
+      buffer.copyToBuffer( *this );
+      return *this;
+    }
+
+    auto operator=( const Buffer&& ) -> Buffer& = delete;
+
+    /// Hands the buffer and its memory to global::deletionQueue if it is enabled.
+    ~Buffer( )
+    {
+      global::deletionQueue.push( _buffer, _memory );
+    }
+
+    auto get( ) const -> const vk::Buffer { return _buffer.get( ); }
+
+    auto getMemory( ) const -> const vk::DeviceMemory { return _memory.get( ).memory; }
+
+    /// @return Returns the buffer's offset inside the memory returned by getMemory().
+    auto getMemoryOffset( ) const -> vk::DeviceSize { return _memory.get( ).offset; }
+
+    /// @return Returns a pointer to the buffer's persistently mapped memory or nullptr if it is not host visible.
+    auto getData( ) const -> void* { return _memory.get( ).mapped; }
+
+    /// @return Returns true if the buffer can be written to directly by the host.
+    auto isHostVisible( ) const -> bool { return _memory.get( ).mapped != nullptr; }
+
+    /// @return Returns true if host writes to the buffer do not need to be flushed.
+    auto isHostCoherent( ) const -> bool { return static_cast<bool>( _memory.get( ).propertyFlags & vk::MemoryPropertyFlagBits::eHostCoherent ); }
+
+    /// Records a range written to by the host, so it will be flushed by the next call to global::allocator.flush().
+    /// @param offset The range's offset within the buffer.
+    /// @param size The range's size in bytes.
+    /// @note Only required if the buffer was written to using getData(). fill() and upload() take care of this automatically.
+    void markDirty( vk::DeviceSize offset = 0, std::optional<vk::DeviceSize> size = { } )
+    {
+      global::allocator.markDirty( _memory.get( ), offset, size.has_value( ) ? size.value( ) : _size - offset );
+    }
+
+    /// Makes device writes to the buffer visible to the host before reading it using getData().
+    /// @param offset The range's offset within the buffer.
+    /// @param size The range's size in bytes.
+    void invalidate( vk::DeviceSize offset = 0, std::optional<vk::DeviceSize> size = { } )
+    {
+      global::allocator.invalidate( _memory.get( ), offset, size.has_value( ) ? size.value( ) : _size - offset );
+    }
+
+    auto getSize( ) const -> const vk::DeviceSize { return _size; }
+
+    /// Exchanges the Vulkan buffer and its memory with those of another buffer.
+    /// @param buffer The buffer to swap with.
+    void swap( Buffer& buffer )
+    {
+      std::swap( _buffer, buffer._buffer );
+      std::swap( _memory, buffer._memory );
+      std::swap( _size, buffer._size );
+      std::swap( _concurrent, buffer._concurrent );
+      std::swap( _released, buffer._released );
+    }
+
+    /// Creates the buffer and allocates memory for it.
     /// @param queueFamilyIndices Specifies which queue family will access the buffer.
     /// @param memoryPropertyFlags Flags for memory allocation.
     /// @param pNextMemory Attachment to the memory's pNext chain.
-    void init( vk::DeviceSize size, vk::BufferUsageFlags usage, const std::vector<uint32_t>& queueFamilyIndices = { }, vk::MemoryPropertyFlags memoryPropertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal, void* pNextMemory = nullptr )
+    /// @param dedicated If true, the buffer will receive its own Vulkan device memory instead of being sub-allocated.
+    /// @param preferredMemoryPropertyFlags Flags the memory should have if possible, e.g. host visibility for device local memory on UMA or ReBAR devices.
+    void init( vk::DeviceSize size, vk::BufferUsageFlags usage, const std::vector<uint32_t>& queueFamilyIndices = { }, vk::MemoryPropertyFlags memoryPropertyFlags = vk::MemoryPropertyFlagBits::eDeviceLocal, void* pNextMemory = nullptr, bool dedicated = false, vk::MemoryPropertyFlags preferredMemoryPropertyFlags = { } )
+    {
+      _size = size;
+
+      // Defer the destruction of a previously created buffer.
+      global::deletionQueue.push( _buffer, _memory );
+
+      _concurrent                 = queueFamilyIndices.size( ) > 1;
+      _released                   = false;
+      vk::SharingMode sharingMode = _concurrent ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive;
+
+      vk::BufferCreateInfo createInfo( { },                                                 // flags
+                                       size,                                                // size
+                                       usage,                                               // usage
+                                       sharingMode,                                         // sharingMode
+                                       static_cast<uint32_t>( queueFamilyIndices.size( ) ), // queueFamilyIndexCount
+                                       queueFamilyIndices.data( ) );                        // pQueueFamilyIndices
+
+      _buffer = global::device.createBufferUnique( createInfo );
+      VK_CORE_ASSERT( _buffer.get( ), "Failed to create buffer." );
+
+      _memory = allocateUnique( _buffer, memoryPropertyFlags, dedicated, pNextMemory, true, preferredMemoryPropertyFlags );
+      global::device.bindBufferMemory( _buffer.get( ), _memory.get( ).memory, _memory.get( ).offset );
+    }
+
+#ifdef VK_EXT_external_memory_host
+    /// Creates the buffer using existing host memory instead of allocating new memory.
+    ///
+    /// The memory is imported using VK_EXT_external_memory_host, so the device reads the data in place without it being copied first.
+    /// @param hostPointer The host memory to import. Both the pointer and size must be multiples of getMinImportedHostPointerAlignment().
+    /// @param size The size of the host memory in bytes.
+    /// @param usage Specifies how the buffer will be used.
+    /// @param queueFamilyIndices Specifies which queue family will access the buffer.
+    /// @note The host memory must stay valid until the buffer's memory has been freed, which global::deletionQueue might defer.
+    void init( void* hostPointer, vk::DeviceSize size, vk::BufferUsageFlags usage, const std::vector<uint32_t>& queueFamilyIndices = { } )
+    {
+      vk::DeviceSize alignment = getMinImportedHostPointerAlignment( );
+      VK_CORE_ASSERT( ( reinterpret_cast<uintptr_t>( hostPointer ) % alignment == 0 && size % alignment == 0 ), "Imported host memory is not aligned to minImportedHostPointerAlignment." );
+
+      _size = size;
+
+      // Defer the destruction of a previously created buffer.
+      global::deletionQueue.push( _buffer, _memory );
+
+      _concurrent                 = queueFamilyIndices.size( ) > 1;
+      _released                   = false;
+      vk::SharingMode sharingMode = _concurrent ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive;
+
+      vk::ExternalMemoryBufferCreateInfo externalCreateInfo( vk::ExternalMemoryHandleTypeFlagBits::eHostAllocationEXT ); // handleTypes
+
+      vk::BufferCreateInfo createInfo( { },                                                 // flags
+                                       size,                                                // size
+                                       usage,                                               // usage
+                                       sharingMode,                                         // sharingMode
+                                       static_cast<uint32_t>( queueFamilyIndices.size( ) ), // queueFamilyIndexCount
+                                       queueFamilyIndices.data( ) );                        // pQueueFamilyIndices
+
+      createInfo.pNext = &externalCreateInfo;
+
+      _buffer = global::device.createBufferUnique( createInfo );
+      VK_CORE_ASSERT( _buffer.get( ), "Failed to create buffer." );
+
+      vk::MemoryRequirements memoryRequirements = getMemoryRequirements( _buffer );
+      VK_CORE_ASSERT( ( memoryRequirements.size <= size ), "The buffer requires more memory than was imported." );
+
+      _memory = UniqueAllocation( global::allocator.importHostPointer( hostPointer, size, memoryRequirements.memoryTypeBits ) );
+      global::device.bindBufferMemory( _buffer.get( ), _memory.get( ).memory, 0 );
+    }
+#endif
+
+    /// Call to copyToBuffer(vk::Buffer).
+    auto copyToBuffer( const Buffer& buffer ) const -> TransferFuture;
+
+    /// Call to copyToBuffer(vk::Buffer, vk::Fence).
+    void copyToBuffer( const Buffer& buffer, vk::Fence fence ) const
+    {
+      copyToBuffer( buffer.get( ), fence );
+    }
+
+    /// Copies the content of this buffer to another vk::Buffer using global::transferEngine.
+    /// @param buffer The target for the copy operation.
+    /// @return Returns a future for the copy.
+    /// @note If a batch is open on global::transferEngine, the copy is recorded into it and the function returns without waiting for it.
+    auto copyToBuffer( vk::Buffer buffer ) const -> TransferFuture;
+
+    /// Copies the content of this buffer to another vk::Buffer in a separate submission without waiting for it.
+    /// @param buffer The target for the copy operation.
+    /// @param fence A fence that is signaled once the copy has finished.
+    void copyToBuffer( vk::Buffer buffer, vk::Fence fence ) const
+    {
+      VK_CORE_ASSERT( fence, "No fence was provided." );
+
+      vk::CommandBuffer commandBuffer = global::transientCommandPool.begin( global::transferFamilyIndex );
+      {
+        vk::BufferCopy copyRegion( 0, 0, _size );
+        commandBuffer.copyBuffer( _buffer.get( ), buffer, 1, &copyRegion ); // CMD
+      }
+      global::transientCommandPool.submit( commandBuffer, global::transferQueue, false, fence );
+    }
+
+    /// Call to copyToImage(vk::Image, vk::Extent3D).
+    auto copyToImage( const Image& image ) const -> TransferFuture;
+
+    /// Copies the content of this buffer to an image using global::transferEngine.
+    ///
+    /// The copy is recorded on the graphics queue family, which owns the image.
+    /// @param image The target for the copy operation. It must be in vk::ImageLayout::eTransferDstOptimal.
+    /// @param extent The target's extent.
+    /// @return Returns a future for the copy.
+    /// @note If a batch is open on global::transferEngine, the copy is recorded into it and the function returns without waiting for it.
+    auto copyToImage( vk::Image image, vk::Extent3D extent ) const -> TransferFuture;
+
+    /// Uploads host data to the buffer.
+    ///
+    /// If the buffer is host visible, the data is written to the mapped memory directly. Otherwise, it is staged and copied using global::transferEngine.
+    /// Direct writes are not ordered with the device's queues, so the device must not be using a host visible buffer while it is written to.
+    /// @param data The data to upload.
+    /// @param size The data's size in bytes.
+    /// @param offset The data's offset within the buffer.
+    /// @note If a batch is open on global::transferEngine and the buffer is not host visible, the function returns without waiting for the upload.
+    /// @note If global::transferEngine runs on a dedicated transfer queue and the buffer is not shared concurrently (see getSharedQueueFamilyIndices()), the written range is handed over to the graphics queue family.
+    /// As the buffer is never handed back, such buffers can only be uploaded to once. Buffers updated repeatedly must be shared concurrently.
+    void upload( const void* data, vk::DeviceSize size, vk::DeviceSize offset = 0 );
+
+    /// Used to fill the buffer with the content of a given std::vector.
+    /// @param data The data to fill the buffer with.
+    /// @param offset The data's offset within the buffer.
+    template <class T>
+    void fill( const std::vector<T>& data, vk::DeviceSize offset = 0, std::optional<vk::DeviceSize> size = { } )
+    {
+      vk::DeviceSize actualSize = data.size( ) * sizeof( data[0] );
+
+      // Host visible memory is mapped persistently by the allocator.
+      void* ptrToData = _memory.get( ).mapped;
+
+      VK_CORE_ASSERT( ( ptrToData != nullptr ), "Failed to copy data to storage staging buffer." );
+      memcpy( static_cast<char*>( ptrToData ) + offset, data.data( ), static_cast<size_t>( actualSize ) );
+      markDirty( offset, actualSize );
+    }
+
+    /// Used to fill the buffer by using a pointer and (optionally) passing the underlying memory size.
+    /// @param data The data to fill the buffer with.
+    /// @param offset The data's offset within the buffer.
+    /// @param size An optional size parameter to pass the size of data. If omitted, the size passed when calling init() will be used instead.
+    template <class T>
+    void fill( const T* data, vk::DeviceSize offset = 0, std::optional<vk::DeviceSize> size = { } )
+    {
+      vk::DeviceSize finalSize = _size;
+      if ( size.has_value( ) )
+      {
+        finalSize = size.value( );
+      }
+
+      // Host visible memory is mapped persistently by the allocator.
+      void* ptrToData = _memory.get( ).mapped;
+
+      VK_CORE_ASSERT( ( ptrToData != nullptr ), "Failed to copy data to storage staging buffer." );
+      memcpy( static_cast<char*>( ptrToData ) + offset, data, static_cast<size_t>( finalSize ) );
+      markDirty( offset, finalSize );
+    }
+
+  protected:
+    vk::UniqueBuffer _buffer;
+    UniqueAllocation _memory;
+
+    vk::DeviceSize _size = 0;
+
+    bool _concurrent = false; ///< True if the buffer is shared concurrently between queue families.
+    bool _released   = false; ///< True if upload() handed the buffer over to the graphics queue family.
+  };
+
+  /// A region of staging memory returned by vkCore::TransferEngine.
+  struct StagingRegion
+  {
+    vk::Buffer buffer     = nullptr; ///< The staging buffer to copy from.
+    vk::DeviceSize offset = 0;       ///< The region's offset inside buffer.
+    void* data            = nullptr; ///< Points to the region's first byte.
+  };
+
+  /// A persistently mapped, host visible ring buffer that uploads are staged through.
+  ///
+  /// Every region is tagged with the id of the submission it is used by. Regions are only handed out again once release() was called with an id that is at least as high.
+  /// @ingroup API
+  class StagingRing
+  {
+  public:
+    /// @return Returns the Vulkan buffer backing the ring.
+    auto getBuffer( ) const -> vk::Buffer { return _buffer ? _buffer->get( ) : nullptr; }
+
+    /// @return Returns the ring's size in bytes.
+    auto getCapacity( ) const -> vk::DeviceSize { return _buffer ? _buffer->getSize( ) : 0; }
+
+    /// @return Returns the memory properties preferred for staging memory.
+    auto getPreferredMemoryPropertyFlags( ) const -> vk::MemoryPropertyFlags { return _preferredMemoryPropertyFlags; }
+
+    /// Creates the ring buffer.
+    /// @param capacity The ring's size in bytes.
+    /// @param preferCached If true, host cached memory is preferred over host coherent memory, e.g. if the staged data is also read by the host. Non-coherent memory is flushed by global::transferEngine.
+    void init( vk::DeviceSize capacity, bool preferCached = false )
+    {
+      _preferredMemoryPropertyFlags = preferCached ? vk::MemoryPropertyFlagBits::eHostCached : vk::MemoryPropertyFlagBits::eHostCoherent;
+
+      _buffer = std::make_unique<Buffer>( capacity,
+                                          vk::BufferUsageFlagBits::eTransferSrc,
+                                          std::vector<uint32_t> { },
+                                          vk::MemoryPropertyFlagBits::eHostVisible,
+                                          nullptr,
+                                          false,
+                                          _preferredMemoryPropertyFlags );
+
+      _data = _buffer->getData( );
+      _regions.clear( );
+      _head = 0;
+    }
+
+    /// Tries to reserve a region without blocking.
+    /// @param size The region's size in bytes.
+    /// @param alignment The region's offset alignment.
+    /// @param submission The id of the submission that will read from the region.
+    /// @return Returns the region if there was enough space left.
+    auto allocate( vk::DeviceSize size, vk::DeviceSize alignment, uint64_t submission ) -> std::optional<StagingRegion>
+    {
+      vk::DeviceSize capacity = getCapacity( );
+      vk::DeviceSize offset   = ( _head + alignment - 1 ) / alignment * alignment;
+
+      if ( _regions.empty( ) )
+      {
+        offset = 0;
+
+        if ( size > capacity )
+        {
+          return { };
+        }
+      }
+      else
+      {
+        vk::DeviceSize tail = _regions.front( ).begin;
+
+        if ( _head > tail )
+        {
+          // The free space is split into the ranges [head, capacity) and [0, tail).
+          if ( offset + size > capacity )
+          {
+            if ( size > tail )
+            {
+              return { };
+            }
+
+            offset = 0;
+          }
+        }
+        else if ( offset + size > tail )
+        {
+          return { };
+        }
+      }
+
+      _regions.push_back( { submission, offset } );
+      _head = offset + size;
+
+      // Non-coherent staging memory is flushed by global::transferEngine before submitting.
+      _buffer->markDirty( offset, size );
+
+      return StagingRegion { _buffer->get( ), offset, static_cast<char*>( _data ) + offset };
+    }
+
+    /// Makes all regions used by submissions up to and including the given id available again.
+    /// @param completedSubmission The id of the most recent submission that has finished executing.
+    void release( uint64_t completedSubmission )
+    {
+      while ( !_regions.empty( ) && _regions.front( ).submission <= completedSubmission )
+      {
+        _regions.pop_front( );
+      }
+
+      if ( _regions.empty( ) )
+      {
+        _head = 0;
+      }
+    }
+
+    /// Destroys the ring buffer.
+    void destroy( )
+    {
+      _buffer.reset( );
+      _data = nullptr;
+      _regions.clear( );
+      _head = 0;
+    }
+
+  private:
+    struct Region
+    {
+      uint64_t submission  = 0;
+      vk::DeviceSize begin = 0;
+    };
+
+    std::unique_ptr<Buffer> _buffer;
+    void* _data = nullptr;
+
+    std::deque<Region> _regions; ///< All regions in use, oldest first.
+    vk::DeviceSize _head = 0;    ///< The end of the most recently reserved region.
+
+    vk::MemoryPropertyFlags _preferredMemoryPropertyFlags = vk::MemoryPropertyFlagBits::eHostCoherent;
+  };
+
+  /// Acquires the ownership of resources released by a submission of vkCore::TransferEngine on another queue family.
+  struct TransferAcquisition
+  {
+    uint32_t queueFamilyIndex       = 0U;      ///< The queue family acquiring the resources.
+    vk::CommandBuffer commandBuffer = nullptr; ///< The command buffer the acquire barriers were recorded to.
+    vk::PipelineStageFlags waitStages;         ///< The stages waiting for the releasing submission.
+    vk::UniqueSemaphore semaphore;             ///< Signaled by the releasing submission.
+    vk::UniqueFence fence;                     ///< Signaled once the acquisition has finished executing.
+  };
+
+  /// Holds everything belonging to a single submission of vkCore::TransferEngine.
+  struct TransferSubmission
+  {
+    uint64_t id                     = 0;           ///< The submission's id. Ids increase monotonically.
+    vk::CommandBuffer commandBuffer = nullptr;     ///< The command buffer the transfer operations were recorded to.
+    vk::UniqueFence fence;                         ///< Signaled once the submission has finished executing.
+    std::vector<std::shared_ptr<void>> resources;  ///< Resources that must stay alive until the submission has finished executing.
+    std::vector<TransferAcquisition> acquisitions; ///< Acquire operations of other queue families waiting on this submission.
+  };
+
+  /// A handle to a submission of vkCore::TransferEngine that can be polled or waited on.
+  /// @ingroup API
+  class TransferFuture
+  {
+  public:
+    TransferFuture( ) = default;
+
+    explicit TransferFuture( std::shared_ptr<const TransferSubmission> submission ) :
+      _submission( std::move( submission ) )
+    {
+    }
+
+    /// @return Returns true if the submission and its acquisitions by other queue families have finished executing. Empty futures are always ready.
+    auto isReady( ) const -> bool
+    {
+      if ( !_submission )
+      {
+        return true;
+      }
+
+      // The submission is still being recorded.
+      if ( !_submission->fence )
+      {
+        return false;
+      }
+
+      for ( vk::Fence fence : getFences( ) )
+      {
+        if ( global::device.getFenceStatus( fence ) != vk::Result::eSuccess )
+        {
+          return false;
+        }
+      }
+
+      return true;
+    }
+
+    /// Blocks until the submission and its acquisitions by other queue families have finished executing.
+    /// @param timeout The maximum amount of nanoseconds to wait for.
+    /// @return Returns true if the submission has finished executing before the timeout expired.
+    auto wait( uint64_t timeout = UINT64_MAX ) const -> bool
+    {
+      if ( !_submission )
+      {
+        return true;
+      }
+
+      VK_CORE_ASSERT( _submission->fence, "Waiting for a submission that has not been flushed yet." );
+
+      std::vector<vk::Fence> fences = getFences( );
+
+      vk::Result result = global::device.waitForFences( static_cast<uint32_t>( fences.size( ) ), fences.data( ), VK_TRUE, timeout );
+      return result == vk::Result::eSuccess;
+    }
+
+  private:
+    auto getFences( ) const -> std::vector<vk::Fence>
+    {
+      std::vector<vk::Fence> fences = { _submission->fence.get( ) };
+      for ( const TransferAcquisition& acquisition : _submission->acquisitions )
+      {
+        fences.push_back( acquisition.fence.get( ) );
+      }
+
+      return fences;
+    }
+
+    std::shared_ptr<const TransferSubmission> _submission;
+  };
+
+  /// A handle to data read back from the device by vkCore::TransferEngine.
+  /// @ingroup API
+  class ReadbackFuture
+  {
+  public:
+    ReadbackFuture( ) = default;
+
+    ReadbackFuture( std::shared_ptr<Buffer> buffer, TransferFuture future ) :
+      _buffer( std::move( buffer ) ),
+      _future( std::move( future ) )
+    {
+    }
+
+    /// @return Returns true if the data has arrived in host memory.
+    auto isReady( ) const -> bool { return _future.isReady( ); }
+
+    /// Blocks until the data has arrived in host memory.
+    /// @param timeout The maximum amount of nanoseconds to wait for.
+    /// @return Returns true if the data has arrived before the timeout expired.
+    auto wait( uint64_t timeout = UINT64_MAX ) const -> bool { return _future.wait( timeout ); }
+
+    /// @return Returns the size of the data in bytes.
+    auto getSize( ) const -> vk::DeviceSize { return _buffer ? _buffer->getSize( ) : 0; }
+
+    /// Returns the data read back from the device.
+    ///
+    /// The mapped memory is invalidated on first access, so the device's writes are visible even if the memory is not host coherent.
+    /// @return Returns a pointer to the persistently mapped readback buffer. It stays valid for as long as this future or a copy of it exists.
+    /// @note The data must be ready.
+    template <typename T = void>
+    auto getData( ) -> const T*
+    {
+      VK_CORE_ASSERT( isReady( ), "Read back data is not ready yet." );
+
+      if ( !_invalidated )
+      {
+        _buffer->invalidate( );
+        _invalidated = true;
+      }
+
+      return static_cast<const T*>( _buffer->getData( ) );
+    }
+
+  private:
+    std::shared_ptr<Buffer> _buffer; ///< The host visible buffer the data is copied to.
+    TransferFuture _future;
+    bool _invalidated = false;
+  };
+
+  /// Records transfer operations into a single command buffer and submits them together.
+  ///
+  /// Instead of submitting and waiting for every copy or layout transition separately, operations are recorded into the command buffer returned by getCommandBuffer().
+  /// flush() submits everything recorded so far with a fence and returns a vkCore::TransferFuture without blocking.
+  /// Resources handed to retain() are kept alive until the submission they were recorded into has finished executing.
+  /// Host data is staged through a single vkCore::StagingRing of fixed size. If the ring is full, the engine waits for the oldest submission still using it.
+  ///
+  /// By default, uploads run on global::transferQueue in parallel to rendering.
+  /// If its queue family differs from the graphics queue family, exclusive resources written by the engine must be handed over to the queue family using them with releaseImage() or releaseBuffer().
+  /// The matching acquire barriers are submitted to the other family's queue, waiting on a semaphore signaled by the engine's submission.
+  /// @note The engine initializes itself lazily using global::transferQueue, or global::graphicsQueue if it is not set, if init() was not called.
+  /// @warning The engine is not thread-safe. destroy() must be called before the logical device is destroyed.
+  /// @ingroup API
+  class TransferEngine
+  {
+  public:
+    TransferEngine( ) = default;
+
+    TransferEngine( const TransferEngine& )  = delete;
+    TransferEngine( const TransferEngine&& ) = delete;
+
+    auto operator=( const TransferEngine& ) -> TransferEngine& = delete;
+    auto operator=( const TransferEngine&& ) -> TransferEngine& = delete;
+
+    /// @return Returns the queue the engine submits to.
+    auto getQueue( ) const -> vk::Queue { return _queue; }
+
+    /// @return Returns the queue family index of the queue the engine submits to.
+    auto getQueueFamilyIndex( ) const -> uint32_t { return _queueFamilyIndex; }
+
+    /// @return Returns true if a batch was opened using beginBatch().
+    auto isBatching( ) const -> bool { return _batching; }
+
+    /// @return Returns a future for the submission currently being recorded, which is not ready before it was flushed. If nothing is being recorded, the last submission's future is returned.
+    auto getFuture( ) const -> TransferFuture
+    {
+      if ( _current )
+      {
+        return TransferFuture( _current );
+      }
+
+      return _submissions.empty( ) ? TransferFuture( ) : TransferFuture( _submissions.back( ) );
+    }
+
+    /// @return Returns the size of the staging ring in bytes.
+    auto getStagingCapacity( ) const -> vk::DeviceSize { return _stagingRing.getCapacity( ); }
+
+    /// @param queueFamilyIndex The queue family that will use resources written by the engine.
+    /// @return Returns true if the engine's queue belongs to a different queue family, so exclusive resources need to change their ownership.
+    auto requiresOwnershipTransfer( uint32_t queueFamilyIndex = global::graphicsFamilyIndex ) const -> bool
+    {
+      if ( _commandPool )
+      {
+        return _queueFamilyIndex != queueFamilyIndex;
+      }
+
+      return ( global::transferQueue ? global::transferFamilyIndex : global::graphicsFamilyIndex ) != queueFamilyIndex;
+    }
+
+    /// Sets the queue acquire barriers for the given queue family are submitted to.
+    /// @param queueFamilyIndex The queue family.
+    /// @param queue A queue of the given family. For global::graphicsFamilyIndex, global::graphicsQueue is used unless specified otherwise.
+    void setAcquireQueue( uint32_t queueFamilyIndex, vk::Queue queue )
+    {
+      _acquireQueues[queueFamilyIndex].queue = queue;
+    }
+
+    /// Sets up the engine.
+    /// @param queue The queue to submit to.
+    /// @param queueFamilyIndex The queue family index of the given queue.
+    /// @param stagingCapacity The size of the staging ring in bytes.
+    /// @param preferCachedStaging If true, staging memory prefers host cached over host coherent memory. See StagingRing::init().
+    void init( vk::Queue queue, uint32_t queueFamilyIndex, vk::DeviceSize stagingCapacity = 64ULL * 1024ULL * 1024ULL, bool preferCachedStaging = false )
+    {
+      _queue            = queue;
+      _queueFamilyIndex = queueFamilyIndex;
+      _commandPool      = initCommandPool( queueFamilyIndex, vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer );
+
+      _stagingRing.init( stagingCapacity, preferCachedStaging );
+    }
+
+    /// Returns the command buffer that is currently being recorded to and starts recording if necessary.
+    /// @return Returns the Vulkan command buffer in the recording state.
+    auto getCommandBuffer( ) -> vk::CommandBuffer
+    {
+      if ( !_commandPool )
+      {
+        // Prefer the transfer queue, so uploads run on the device's copy engine in parallel to rendering.
+        if ( global::transferQueue )
+        {
+          init( global::transferQueue, global::transferFamilyIndex );
+        }
+        else
+        {
+          init( global::graphicsQueue, global::graphicsFamilyIndex );
+        }
+      }
+
+      if ( !_current )
+      {
+        collect( );
+
+        _current     = std::make_shared<TransferSubmission>( );
+        _current->id = ++_submissionCount;
+
+        if ( !_freeCommandBuffers.empty( ) )
+        {
+          _current->commandBuffer = _freeCommandBuffers.back( );
+          _freeCommandBuffers.pop_back( );
+        }
+        else
+        {
+          vk::CommandBufferAllocateInfo allocateInfo( _commandPool,                     // commandPool
+                                                      vk::CommandBufferLevel::ePrimary, // level
+                                                      1U );                             // commandBufferCount
+
+          _current->commandBuffer = global::device.allocateCommandBuffers( allocateInfo ).front( );
+          VK_CORE_ASSERT( _current->commandBuffer, "Failed to create command buffers." );
+        }
+
+        _current->commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+      }
+
+      return _current->commandBuffer;
+    }
+
+    /// Reserves a region of staging memory that is valid until the current submission has finished executing.
+    ///
+    /// Requests larger than the staging ring receive a temporary staging buffer instead.
+    /// @param size The region's size in bytes.
+    /// @param alignment The region's offset alignment.
+    /// @return Returns the region.
+    /// @note If the ring is full, this function may submit the current command buffer. Always call getCommandBuffer() after reserving.
+    auto reserve( vk::DeviceSize size, vk::DeviceSize alignment = 16 ) -> StagingRegion
+    {
+      getCommandBuffer( );
+
+      if ( size > _stagingRing.getCapacity( ) )
+      {
+        auto stagingBuffer = std::make_shared<Buffer>( size,
+                                                       vk::BufferUsageFlagBits::eTransferSrc,
+                                                       std::vector<uint32_t> { },
+                                                       vk::MemoryPropertyFlagBits::eHostVisible,
+                                                       nullptr,
+                                                       false,
+                                                       _stagingRing.getPreferredMemoryPropertyFlags( ) );
+
+        stagingBuffer->markDirty( );
+        retain( stagingBuffer );
+        return StagingRegion { stagingBuffer->get( ), 0, stagingBuffer->getData( ) };
+      }
+
+      for ( ;; )
+      {
+        if ( auto region = _stagingRing.allocate( size, alignment, _current->id ); region.has_value( ) )
+        {
+          return region.value( );
+        }
+
+        // The ring is full. Make sure the ring's oldest region is in flight and wait for it.
+        if ( _submissions.empty( ) )
+        {
+          flush( );
+        }
+
+        TransferFuture( _submissions.front( ) ).wait( );
+        collect( );
+        getCommandBuffer( );
+      }
+    }
+
+    /// Copies host data to staging memory.
+    /// @param data The data to stage.
+    /// @param size The data's size in bytes.
+    /// @param alignment The region's offset alignment.
+    /// @return Returns the region containing the data.
+    /// @note If the ring is full, this function may submit the current command buffer. Always call getCommandBuffer() after staging.
+    auto stage( const void* data, vk::DeviceSize size, vk::DeviceSize alignment = 16 ) -> StagingRegion
+    {
+      StagingRegion region = reserve( size, alignment );
+      memcpy( region.data, data, static_cast<size_t>( size ) );
+
+      return region;
+    }
+
+    /// Records an upload of host data to a buffer. Data larger than the staging ring is uploaded in chunks.
+    /// @param data The data to upload.
+    /// @param size The data's size in bytes.
+    /// @param dst The destination buffer.
+    /// @param dstOffset The data's offset inside the destination buffer.
+    void upload( const void* data, vk::DeviceSize size, vk::Buffer dst, vk::DeviceSize dstOffset = 0 )
+    {
+      if ( !_commandPool )
+      {
+        getCommandBuffer( );
+      }
+
+      // Use at most half of the ring per chunk, so the next chunk can be staged while the previous one is being copied.
+      vk::DeviceSize chunkSize = std::max<vk::DeviceSize>( _stagingRing.getCapacity( ) / 2, 1 );
+
+      for ( vk::DeviceSize offset = 0; offset < size; offset += chunkSize )
+      {
+        vk::DeviceSize currentSize = std::min( chunkSize, size - offset );
+        StagingRegion region       = stage( static_cast<const char*>( data ) + offset, currentSize );
+
+        copyBuffer( region.buffer, dst, { vk::BufferCopy( region.offset, dstOffset + offset, currentSize ) } );
+      }
+    }
+
+    /// Streams a file into a buffer in chunks.
+    ///
+    /// Every chunk is read from the file straight into staging memory and submitted right away, so the device copies a chunk while the next one is read.
+    /// Host memory usage is bounded by the staging ring, regardless of the file's size.
+    /// @param path The path to the file.
+    /// @param dst The destination buffer.
+    /// @param dstOffset The data's offset inside the destination buffer.
+    /// @param fileOffset The offset inside the file to start reading at.
+    /// @param size The number of bytes to upload. If VK_WHOLE_SIZE, the rest of the file is uploaded.
+    /// @param chunkSize The maximum size of a single chunk in bytes. At most half of the staging ring is used per chunk.
+    /// @param release If true, the written range is handed over to the graphics queue family using releaseBuffer() once all chunks have been copied.
+    /// This is required for buffers that are not shared concurrently if the engine runs on a dedicated transfer queue, and invalid for concurrently shared buffers.
+    /// @return Returns a future for the last chunk's submission.
+    /// @note This function submits even if a batch is open.
+    auto uploadFile( std::string_view path, vk::Buffer dst, vk::DeviceSize dstOffset = 0, vk::DeviceSize fileOffset = 0, vk::DeviceSize size = VK_WHOLE_SIZE, vk::DeviceSize chunkSize = 8ULL * 1024ULL * 1024ULL, bool release = false ) -> TransferFuture
+    {
+      std::ifstream file = openFile( path, fileOffset, size );
+      chunkSize          = getFileChunkSize( chunkSize );
+
+      for ( vk::DeviceSize offset = 0; offset < size; offset += chunkSize )
+      {
+        vk::DeviceSize currentSize = std::min( chunkSize, size - offset );
+        StagingRegion region       = reserve( currentSize );
+        readFileChunk( file, region, currentSize );
+
+        copyBuffer( region.buffer, dst, { vk::BufferCopy( region.offset, dstOffset + offset, currentSize ) } );
+        flush( );
+      }
+
+      // The release's first synchronization scope covers the copies of all chunks, as they were submitted to the same queue before.
+      if ( release )
+      {
+        releaseBuffer( dst, vk::AccessFlagBits::eMemoryRead, vk::PipelineStageFlagBits::eAllCommands, global::graphicsFamilyIndex, dstOffset, size );
+      }
+
+      return flush( );
+    }
+
+    /// Streams tightly packed texels from a file into a single subresource of an image in chunks of whole rows.
+    ///
+    /// Every chunk is read from the file straight into staging memory and submitted right away, so the device copies a chunk while the next one is read.
+    /// The subresource's previous contents are discarded by transitioning it from vk::ImageLayout::eUndefined, which only involves the transfer stage and therefore is legal on a dedicated transfer queue.
+    /// It stays in vk::ImageLayout::eTransferDstOptimal. Transition it or hand it over using releaseImage() afterwards.
+    /// @param path The path to the file.
+    /// @param image The destination image. Only 2D images with uncompressed formats are supported.
+    /// @param texelSize The size of a single texel in bytes.
+    /// @param fileOffset The offset inside the file to start reading at.
+    /// @param mipLevel The subresource's mip level.
+    /// @param arrayLayer The subresource's array layer.
+    /// @param chunkSize The maximum size of a single chunk in bytes. At most half of the staging ring is used per chunk, but a chunk always contains at least one row.
+    /// @return Returns a future for the last chunk's submission.
+    /// @note This function submits even if a batch is open.
+    /// @note Previous uses of the image on other queues must have finished or be synchronized with the engine's queue by the caller.
+    auto uploadFile( std::string_view path, Image& image, vk::DeviceSize texelSize, vk::DeviceSize fileOffset = 0, uint32_t mipLevel = 0, uint32_t arrayLayer = 0, vk::DeviceSize chunkSize = 8ULL * 1024ULL * 1024ULL ) -> TransferFuture
+    {
+      uint32_t width  = std::max( image.getExtent( ).width >> mipLevel, 1U );
+      uint32_t height = std::max( image.getExtent( ).height >> mipLevel, 1U );
+
+      VK_CORE_ASSERT( ( image.getExtent( ).depth == 1 ), "Streaming files into 3D images is not supported." );
+
+      vk::DeviceSize rowSize = texelSize * width;
+      vk::DeviceSize size    = rowSize * height;
+
+      std::ifstream file = openFile( path, fileOffset, size );
+
+      auto rowsPerChunk = static_cast<uint32_t>( std::max<vk::DeviceSize>( getFileChunkSize( chunkSize ) / rowSize, 1 ) );
+
+      // Buffer offsets of image copies must be a multiple of both the texel size and four.
+      vk::DeviceSize alignment = std::lcm( texelSize, vk::DeviceSize { 4 } );
+
+      vk::ImageAspectFlags aspectMask = getImageAspectFlags( image.getFormat( ) );
+      vk::ImageSubresourceRange range( aspectMask, mipLevel, 1, arrayLayer, 1 );
+
+      // Transitioning from the tracked layout would involve the stages of its previous use, e.g. shader stages the engine's queue might not support.
+      image.setLayout( vk::ImageLayout::eUndefined, &range );
+      image.transitionToLayout( vk::ImageLayout::eTransferDstOptimal, getCommandBuffer( ), &range );
+
+      for ( uint32_t row = 0; row < height; row += rowsPerChunk )
+      {
+        uint32_t rowCount    = std::min( rowsPerChunk, height - row );
+        StagingRegion region = reserve( rowSize * rowCount, alignment );
+        readFileChunk( file, region, rowSize * rowCount );
+
+        vk::BufferImageCopy copy( region.offset,                                      // bufferOffset
+                                  0,                                                  // bufferRowLength
+                                  0,                                                  // bufferImageHeight
+                                  { aspectMask, mipLevel, arrayLayer, 1 },            // imageSubresource (aspectMask, mipLevel, baseArrayLayer, layerCount)
+                                  vk::Offset3D { 0, static_cast<int32_t>( row ), 0 }, // imageOffset
+                                  vk::Extent3D { width, rowCount, 1 } );              // imageExtent
+
+        getCommandBuffer( ).copyBufferToImage( region.buffer, image.get( ), vk::ImageLayout::eTransferDstOptimal, 1, &copy ); // CMD
+        flush( );
+      }
+
+      return flush( );
+    }
+
+    /// Records a buffer to buffer copy.
+    /// @param src The source buffer.
+    /// @param dst The destination buffer.
+    /// @param regions The regions to copy.
+    void copyBuffer( vk::Buffer src, vk::Buffer dst, const std::vector<vk::BufferCopy>& regions )
+    {
+      getCommandBuffer( ).copyBuffer( src, dst, static_cast<uint32_t>( regions.size( ) ), regions.data( ) ); // CMD
+    }
+
+    /// Keeps a resource alive until the operations recorded so far have finished executing.
+    /// @param resource The resource to keep alive.
+    void retain( std::shared_ptr<void> resource )
+    {
+      getCommandBuffer( );
+      _current->resources.push_back( std::move( resource ) );
+    }
+
+    /// Records a copy of a buffer range into host visible memory, preferably host cached, without waiting for it.
+    ///
+    /// The copy is recorded on the queue family that wrote the range, so it needs neither an ownership transfer nor pipeline stages the engine's queue might not support.
+    /// If the engine's queue belongs to another family, the copy is submitted to the family's acquire queue (see setAcquireQueue()) after the engine's submission.
+    /// Unless a batch is open, the copy is submitted right away.
+    /// @param buffer The buffer to read from.
+    /// @param size The size of the range in bytes.
+    /// @param offset The offset of the range.
+    /// @param srcAccessMask The accesses that wrote the range, e.g. of a compute shader.
+    /// @param srcStageMask The stages that wrote the range.
+    /// @param queueFamilyIndex The queue family that wrote the range.
+    /// @return Returns a future for the data.
+    /// @note Writes must have been submitted to the queue the copy is submitted to, or be synchronized with it by the caller, e.g. using a semaphore.
+    auto readback( vk::Buffer buffer, vk::DeviceSize size, vk::DeviceSize offset = 0, vk::AccessFlags srcAccessMask = vk::AccessFlagBits::eShaderWrite, vk::PipelineStageFlags srcStageMask = vk::PipelineStageFlagBits::eAllCommands, uint32_t queueFamilyIndex = global::graphicsFamilyIndex ) -> ReadbackFuture
+    {
+      auto readbackBuffer = initReadbackBuffer( size );
+
+      vk::CommandBuffer commandBuffer = getAcquireCommandBuffer( queueFamilyIndex );
+
+      vk::BufferMemoryBarrier barrier( srcAccessMask,                     // srcAccessMask
+                                       vk::AccessFlagBits::eTransferRead, // dstAccessMask
+                                       VK_QUEUE_FAMILY_IGNORED,           // srcQueueFamilyIndex
+                                       VK_QUEUE_FAMILY_IGNORED,           // dstQueueFamilyIndex
+                                       buffer,                            // buffer
+                                       offset,                            // offset
+                                       size );                            // size
+
+      recordBufferMemoryBarrier( commandBuffer, barrier, srcStageMask, vk::PipelineStageFlagBits::eTransfer, TransferCommandBits::eAll, TransferCommandBits::eCopy );
+
+      vk::BufferCopy region( offset, 0, size );
+      commandBuffer.copyBuffer( buffer, readbackBuffer->get( ), 1, &region ); // CMD
+
+      return submitReadback( commandBuffer, std::move( readbackBuffer ) );
+    }
+
+    /// Records a copy of a single subresource of an image into host visible memory, preferably host cached, without waiting for it.
+    ///
+    /// The subresource is transitioned to vk::ImageLayout::eTransferSrcOptimal and stays in that layout. Unless a batch is open, the copy is submitted right away.
+    /// Like readback(vk::Buffer, vk::DeviceSize, vk::DeviceSize, vk::AccessFlags, vk::PipelineStageFlags, uint32_t), the copy is recorded on the queue family owning the image.
+    /// @param image The image to read from. It must have been created with transfer source usage.
+    /// @param texelSize The size of a single texel of the given aspect in bytes, e.g. 4 for the depth aspect of vk::Format::eD24UnormS8Uint. Block-compressed formats are not supported.
+    /// @param mipLevel The subresource's mip level.
+    /// @param arrayLayer The subresource's array layer.
+    /// @param aspect The aspect to read. Depth and stencil aspects must be read separately.
+    /// @param queueFamilyIndex The queue family owning the image.
+    /// @return Returns a future for the tightly packed texels.
+    auto readback( Image& image, vk::DeviceSize texelSize, uint32_t mipLevel = 0, uint32_t arrayLayer = 0, vk::ImageAspectFlagBits aspect = vk::ImageAspectFlagBits::eColor, uint32_t queueFamilyIndex = global::graphicsFamilyIndex ) -> ReadbackFuture
+    {
+      vk::ImageAspectFlags aspectMask = getImageAspectFlags( image.getFormat( ) );
+      VK_CORE_ASSERT( ( aspectMask & aspect ), "The image does not have the aspect to read back." );
+
+      vk::Extent3D extent( std::max( image.getExtent( ).width >> mipLevel, 1U ),
+                           std::max( image.getExtent( ).height >> mipLevel, 1U ),
+                           std::max( image.getExtent( ).depth >> mipLevel, 1U ) );
+
+      auto readbackBuffer = initReadbackBuffer( texelSize * extent.width * extent.height * extent.depth );
+
+      vk::CommandBuffer commandBuffer = getAcquireCommandBuffer( queueFamilyIndex );
+
+      // Layout transitions always cover all aspects of the image.
+      vk::ImageSubresourceRange range( aspectMask, mipLevel, 1, arrayLayer, 1 );
+      image.transitionToLayout( vk::ImageLayout::eTransferSrcOptimal, commandBuffer, &range );
+
+      vk::BufferImageCopy region( 0,                                   // bufferOffset
+                                  0,                                   // bufferRowLength
+                                  0,                                   // bufferImageHeight
+                                  { aspect, mipLevel, arrayLayer, 1 }, // imageSubresource (aspectMask, mipLevel, baseArrayLayer, layerCount)
+                                  vk::Offset3D { 0, 0, 0 },            // imageOffset
+                                  extent );                            // imageExtent
+
+      commandBuffer.copyImageToBuffer( image.get( ), vk::ImageLayout::eTransferSrcOptimal, readbackBuffer->get( ), 1, &region ); // CMD
+
+      return submitReadback( commandBuffer, std::move( readbackBuffer ) );
+    }
+
+    /// Hands a buffer written by the engine over to another queue family.
+    ///
+    /// Records a release barrier into the current command buffer and the matching acquire barrier into the command buffer returned by getAcquireCommandBuffer().
+    /// If the engine's queue already belongs to the given family, a regular memory barrier is recorded instead.
+    /// @param buffer The buffer.
+    /// @param dstAccessMask The accesses of the destination queue family to make the engine's writes visible to.
+    /// @param dstStageMask The stages of the destination queue family that will access the buffer.
+    /// @param dstQueueFamilyIndex The queue family that will use the buffer.
+    /// @param offset The offset of the range to hand over.
+    /// @param size The size of the range to hand over.
+    void releaseBuffer( vk::Buffer buffer, vk::AccessFlags dstAccessMask, vk::PipelineStageFlags dstStageMask, uint32_t dstQueueFamilyIndex = global::graphicsFamilyIndex, vk::DeviceSize offset = 0, vk::DeviceSize size = VK_WHOLE_SIZE )
+    {
+      vk::CommandBuffer commandBuffer = getCommandBuffer( );
+
+      vk::BufferMemoryBarrier barrier( vk::AccessFlagBits::eTransferWrite, // srcAccessMask
+                                       dstAccessMask,                      // dstAccessMask
+                                       VK_QUEUE_FAMILY_IGNORED,            // srcQueueFamilyIndex
+                                       VK_QUEUE_FAMILY_IGNORED,            // dstQueueFamilyIndex
+                                       buffer,                             // buffer
+                                       offset,                             // offset
+                                       size );                             // size
+
+      if ( !requiresOwnershipTransfer( dstQueueFamilyIndex ) )
+      {
+        recordBufferMemoryBarrier( commandBuffer, barrier, vk::PipelineStageFlagBits::eTransfer, dstStageMask, TransferCommandBits::eCopy );
+        return;
+      }
+
+      barrier.srcQueueFamilyIndex = _queueFamilyIndex;
+      barrier.dstQueueFamilyIndex = dstQueueFamilyIndex;
+
+      // The release only needs to make the writes available. Visibility is up to the acquire.
+      vk::BufferMemoryBarrier release = barrier;
+      release.dstAccessMask           = { };
+      recordBufferMemoryBarrier( commandBuffer, release, vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eBottomOfPipe, TransferCommandBits::eCopy );
+
+      // The acquire's source stages are chained to the semaphore wait.
+      vk::BufferMemoryBarrier acquire = barrier;
+      acquire.srcAccessMask           = { };
+      recordBufferMemoryBarrier( getAcquisition( dstQueueFamilyIndex, dstStageMask ).commandBuffer, acquire, dstStageMask, dstStageMask );
+    }
+
+    /// Hands an image written by the engine over to another queue family and optionally changes its layout.
+    ///
+    /// Records a release barrier into the current command buffer and the matching acquire barrier into the command buffer returned by getAcquireCommandBuffer().
+    /// If the engine's queue already belongs to the given family, a regular layout transition is recorded instead.
+    /// @param image The image.
+    /// @param oldLayout The layout the image was written in.
+    /// @param newLayout The layout the destination queue family expects. The accesses and stages of the acquire are derived from it.
+    /// @param subresourceRange The subresources to hand over.
+    /// @param dstQueueFamilyIndex The queue family that will use the image.
+    /// @note Layout tracking, e.g. of vkCore::Image, must be updated by the caller.
+    void releaseImage( vk::Image image, vk::ImageLayout oldLayout, vk::ImageLayout newLayout, const vk::ImageSubresourceRange& subresourceRange, uint32_t dstQueueFamilyIndex = global::graphicsFamilyIndex )
+    {
+      vk::CommandBuffer commandBuffer = getCommandBuffer( );
+
+      if ( !requiresOwnershipTransfer( dstQueueFamilyIndex ) )
+      {
+        if ( oldLayout != newLayout )
+        {
+          recordImageMemoryBarrier( commandBuffer, getImageMemoryBarrierInfo( image, oldLayout, newLayout, &subresourceRange ), TransferCommandBits::eCopy );
+        }
+
+        return;
+      }
+
+      auto srcInfo = getLayoutAccessInfo( oldLayout );
+      auto dstInfo = getLayoutAccessInfo( newLayout );
+
+      vk::ImageMemoryBarrier barrier( getWriteAccess( srcInfo.first ), // srcAccessMask
+                                      dstInfo.first,                   // dstAccessMask
+                                      oldLayout,                       // oldLayout
+                                      newLayout,                       // newLayout
+                                      _queueFamilyIndex,               // srcQueueFamilyIndex
+                                      dstQueueFamilyIndex,             // dstQueueFamilyIndex
+                                      image,                           // image
+                                      subresourceRange );              // subresourceRange
+
+      // Both barriers specify the same layout transition, which is executed once between the release and the acquire.
+      vk::ImageMemoryBarrier release = barrier;
+      release.dstAccessMask          = { };
+      recordImageMemoryBarrier( commandBuffer, { release, srcInfo.second, vk::PipelineStageFlagBits::eBottomOfPipe }, TransferCommandBits::eCopy );
+
+      vk::ImageMemoryBarrier acquire = barrier;
+      acquire.srcAccessMask          = { };
+      recordImageMemoryBarrier( getAcquisition( dstQueueFamilyIndex, dstInfo.second ).commandBuffer, { acquire, dstInfo.second, dstInfo.second } );
+    }
+
+    /// Returns a command buffer of the given queue family that is submitted after the current command buffer, once all resources released to that family have been acquired.
+    ///
+    /// Used to record follow-up work on the resources that the engine's queue does not support, e.g. blits on a transfer-only queue.
+    /// If the engine's queue already belongs to the given family, the current command buffer is returned.
+    /// @param queueFamilyIndex The queue family.
+    /// @return Returns the command buffer in the recording state.
+    /// @note The same rules as for getCommandBuffer() apply, i.e. call this again after staging.
+    auto getAcquireCommandBuffer( uint32_t queueFamilyIndex = global::graphicsFamilyIndex ) -> vk::CommandBuffer
+    {
+      vk::CommandBuffer commandBuffer = getCommandBuffer( );
+
+      if ( !requiresOwnershipTransfer( queueFamilyIndex ) )
+      {
+        return commandBuffer;
+      }
+
+      return getAcquisition( queueFamilyIndex, { } ).commandBuffer;
+    }
+
+    /// Opens a batch. Until endBatch() is called, commit() will not submit anything.
+    void beginBatch( )
+    {
+      _batching = true;
+    }
+
+    /// Closes the batch opened by beginBatch() and submits all operations recorded during the batch.
+    /// @return Returns a future for the batch's submission.
+    auto endBatch( ) -> TransferFuture
+    {
+      _batching = false;
+      return flush( );
+    }
+
+    /// Submits all recorded operations without waiting for them to finish.
+    /// @return Returns a future for the submission. If nothing was recorded, the last submission's future is returned.
+    auto flush( ) -> TransferFuture
+    {
+      // Make host writes to non-coherent memory visible to the device.
+      global::allocator.flush( );
+
+      if ( !_current )
+      {
+        return getFuture( );
+      }
+
+      _current->commandBuffer.end( );
+      _current->fence = initFenceUnique( { } );
+
+      std::vector<vk::Semaphore> signalSemaphores;
+      for ( const TransferAcquisition& acquisition : _current->acquisitions )
+      {
+        signalSemaphores.push_back( acquisition.semaphore.get( ) );
+      }
+
+      submitCommandBuffer( _queue, _current->commandBuffer, _current->fence.get( ), { }, { }, signalSemaphores );
+
+      // Other queue families acquire the released resources once the submission above has finished.
+      for ( TransferAcquisition& acquisition : _current->acquisitions )
+      {
+        acquisition.commandBuffer.end( );
+        acquisition.fence = initFenceUnique( { } );
+
+        vk::PipelineStageFlags waitStages = acquisition.waitStages ? acquisition.waitStages : vk::PipelineStageFlagBits::eAllCommands;
+        submitCommandBuffer( _acquireQueues[acquisition.queueFamilyIndex].queue, acquisition.commandBuffer, acquisition.fence.get( ), { acquisition.semaphore.get( ) }, { waitStages } );
+      }
+
+      _submissions.push_back( std::move( _current ) );
+      _current = nullptr;
+
+      return TransferFuture( _submissions.back( ) );
+    }
+
+    /// Used by vkCore resources after recording uploads. Submits and waits for completion unless a batch is open.
+    void commit( )
+    {
+      if ( !_batching )
+      {
+        flush( ).wait( );
+      }
+    }
+
+    /// Releases the resources of all submissions that have finished executing and recycles their command buffers.
+    void collect( )
+    {
+      auto it = _submissions.begin( );
+      for ( ; it != _submissions.end( ); ++it )
+      {
+        // Submissions finish in order, so there is no need to look any further.
+        if ( !TransferFuture( *it ).isReady( ) )
+        {
+          break;
+        }
+
+        ( *it )->commandBuffer.reset( { } );
+        _freeCommandBuffers.push_back( ( *it )->commandBuffer );
+        ( *it )->resources.clear( );
+
+        for ( TransferAcquisition& acquisition : ( *it )->acquisitions )
+        {
+          acquisition.commandBuffer.reset( { } );
+          _acquireQueues[acquisition.queueFamilyIndex].freeCommandBuffers.push_back( acquisition.commandBuffer );
+        }
+
+        ( *it )->acquisitions.clear( );
+
+        _stagingRing.release( ( *it )->id );
+      }
+
+      _submissions.erase( _submissions.begin( ), it );
+    }
+
+    /// Submits all recorded operations and blocks until every submission has finished executing.
+    void waitIdle( )
+    {
+      flush( ).wait( );
+      collect( );
+    }
+
+    /// Waits for all submissions and destroys the engine's command pool.
+    void destroy( )
+    {
+      if ( !_commandPool )
+      {
+        return;
+      }
+
+      waitIdle( );
+
+      _freeCommandBuffers.clear( );
+      _submissions.clear( );
+      _stagingRing.destroy( );
+
+      for ( auto& it : _acquireQueues )
+      {
+        if ( it.second.commandPool )
+        {
+          global::device.destroyCommandPool( it.second.commandPool );
+        }
+      }
+
+      _acquireQueues.clear( );
+
+      global::device.destroyCommandPool( _commandPool );
+      _commandPool = nullptr;
+    }
+
+  private:
+    /// The queue and command buffers used to acquire resources on another queue family.
+    struct AcquireQueue
+    {
+      vk::Queue queue             = nullptr;
+      vk::CommandPool commandPool = nullptr;
+      std::vector<vk::CommandBuffer> freeCommandBuffers;
+    };
+
+    /// Opens a file for a chunked upload.
+    /// @param path The path to the file.
+    /// @param offset The offset to start reading at.
+    /// @param size The number of bytes that will be read. If VK_WHOLE_SIZE, it is set to the rest of the file.
+    /// @return Returns the file positioned at the given offset.
+    auto openFile( std::string_view path, vk::DeviceSize offset, vk::DeviceSize& size ) -> std::ifstream
+    {
+      std::ifstream file( std::string( path ), std::ios::binary | std::ios::ate );
+      if ( !file.is_open( ) )
+      {
+        VK_CORE_THROW( "Failed to open file ", path );
+      }
+
+      auto fileSize = static_cast<vk::DeviceSize>( file.tellg( ) );
+      if ( size == VK_WHOLE_SIZE )
+      {
+        size = fileSize > offset ? fileSize - offset : 0;
+      }
+
+      VK_CORE_ASSERT( ( offset + size <= fileSize ), "The file is smaller than the requested range." );
+
+      file.seekg( static_cast<std::streamoff>( offset ) );
+      return file;
+    }
+
+    /// Reads the next chunk of a file straight into staging memory.
+    /// @param file The file to read from.
+    /// @param region The staging region to read to.
+    /// @param size The chunk's size in bytes.
+    void readFileChunk( std::ifstream& file, const StagingRegion& region, vk::DeviceSize size )
+    {
+      file.read( static_cast<char*>( region.data ), static_cast<std::streamsize>( size ) );
+      if ( !file )
+      {
+        VK_CORE_THROW( "Failed to read file chunk." );
+      }
+    }
+
+    /// @param chunkSize The requested chunk size in bytes.
+    /// @return Returns the requested chunk size limited to half of the staging ring, so the next chunk can be read while the previous one is being copied.
+    auto getFileChunkSize( vk::DeviceSize chunkSize ) -> vk::DeviceSize
+    {
+      getCommandBuffer( );
+      return std::max<vk::DeviceSize>( std::min( chunkSize, _stagingRing.getCapacity( ) / 2 ), 1 );
+    }
+
+    /// Creates a buffer data can be read back to.
+    /// @param size The buffer's size in bytes.
+    /// @return Returns the buffer.
+    auto initReadbackBuffer( vk::DeviceSize size ) -> std::shared_ptr<Buffer>
+    {
+      // Host cached memory makes reading the data on the host much faster.
+      return std::make_shared<Buffer>( size,
+                                       vk::BufferUsageFlagBits::eTransferDst,
+                                       std::vector<uint32_t> { },
+                                       vk::MemoryPropertyFlagBits::eHostVisible,
+                                       nullptr,
+                                       false,
+                                       vk::MemoryPropertyFlagBits::eHostCached );
+    }
+
+    /// Makes the copy into a readback buffer visible to the host and submits it unless a batch is open.
+    /// @param commandBuffer The command buffer the copy was recorded to.
+    /// @param readbackBuffer The buffer the data was copied to.
+    /// @return Returns a future for the data.
+    auto submitReadback( vk::CommandBuffer commandBuffer, std::shared_ptr<Buffer> readbackBuffer ) -> ReadbackFuture
+    {
+      recordMemoryBarrier( commandBuffer, vk::AccessFlagBits::eTransferWrite, vk::AccessFlagBits::eHostRead, vk::PipelineStageFlagBits::eTransfer, vk::PipelineStageFlagBits::eHost, TransferCommandBits::eCopy );
+
+      // Keeps the buffer alive even if the future is discarded before the copy has finished.
+      retain( readbackBuffer );
+
+      TransferFuture future( _current );
+      if ( !_batching )
+      {
+        flush( );
+      }
+
+      return ReadbackFuture( std::move( readbackBuffer ), std::move( future ) );
+    }
+
+    /// Returns the acquisition of the current submission for the given queue family and starts recording it if necessary.
+    /// @param queueFamilyIndex The acquiring queue family.
+    /// @param waitStages The stages that must wait for the current submission.
+    /// @return Returns the acquisition.
+    auto getAcquisition( uint32_t queueFamilyIndex, vk::PipelineStageFlags waitStages ) -> TransferAcquisition&
+    {
+      getCommandBuffer( );
+
+      for ( TransferAcquisition& acquisition : _current->acquisitions )
+      {
+        if ( acquisition.queueFamilyIndex == queueFamilyIndex )
+        {
+          acquisition.waitStages |= waitStages;
+          return acquisition;
+        }
+      }
+
+      AcquireQueue& acquireQueue = _acquireQueues[queueFamilyIndex];
+      if ( !acquireQueue.queue && queueFamilyIndex == global::graphicsFamilyIndex )
+      {
+        acquireQueue.queue = global::graphicsQueue;
+      }
+
+      VK_CORE_ASSERT( acquireQueue.queue, "No acquire queue was set for the queue family." );
+
+      if ( !acquireQueue.commandPool )
+      {
+        acquireQueue.commandPool = initCommandPool( queueFamilyIndex, vk::CommandPoolCreateFlagBits::eTransient | vk::CommandPoolCreateFlagBits::eResetCommandBuffer );
+      }
+
+      TransferAcquisition acquisition;
+      acquisition.queueFamilyIndex = queueFamilyIndex;
+      acquisition.waitStages       = waitStages;
+      acquisition.semaphore        = initSemaphoreUnique( );
+
+      if ( !acquireQueue.freeCommandBuffers.empty( ) )
+      {
+        acquisition.commandBuffer = acquireQueue.freeCommandBuffers.back( );
+        acquireQueue.freeCommandBuffers.pop_back( );
+      }
+      else
+      {
+        vk::CommandBufferAllocateInfo allocateInfo( acquireQueue.commandPool,         // commandPool
+                                                    vk::CommandBufferLevel::ePrimary, // level
+                                                    1U );                             // commandBufferCount
+
+        acquisition.commandBuffer = global::device.allocateCommandBuffers( allocateInfo ).front( );
+        VK_CORE_ASSERT( acquisition.commandBuffer, "Failed to create command buffers." );
+      }
+
+      acquisition.commandBuffer.begin( vk::CommandBufferBeginInfo( vk::CommandBufferUsageFlagBits::eOneTimeSubmit ) );
+
+      _current->acquisitions.push_back( std::move( acquisition ) );
+      return _current->acquisitions.back( );
+    }
+
+    vk::Queue _queue             = nullptr;
+    vk::CommandPool _commandPool = nullptr;
+    uint32_t _queueFamilyIndex   = 0U;
+    uint64_t _submissionCount    = 0U;
+    bool _batching               = false;
+
+    StagingRing _stagingRing; ///< The staging memory all uploads are suballocated from.
+
+    std::shared_ptr<TransferSubmission> _current;                   ///< The submission currently being recorded.
+    std::vector<std::shared_ptr<TransferSubmission>> _submissions; ///< Submissions that might still be executing, in submission order.
+    std::vector<vk::CommandBuffer> _freeCommandBuffers;            ///< Command buffers of finished submissions ready to be reused.
+    std::map<uint32_t, AcquireQueue> _acquireQueues;               ///< The queues resources are handed over to, by queue family index.
+  };
+
+  namespace global
+  {
+    inline TransferEngine transferEngine; ///< The transfer engine used by all vkCore resources to upload data.
+  } // namespace global
+
+  inline void Buffer::upload( const void* data, vk::DeviceSize size, vk::DeviceSize offset )
+  {
+    VK_CORE_ASSERT( ( offset + size <= _size ), "Exceeded buffer size." );
+
+    if ( isHostVisible( ) )
+    {
+      memcpy( static_cast<char*>( getData( ) ) + offset, data, static_cast<size_t>( size ) );
+      markDirty( offset, size );
+
+      if ( !global::transferEngine.isBatching( ) )
+      {
+        global::allocator.flush( );
+      }
+
+      return;
+    }
+
+    bool release = !_concurrent && global::transferEngine.requiresOwnershipTransfer( );
+    if ( release )
+    {
+      // Nothing hands the buffer back to the engine's queue family or orders the copy after the graphics queue's reads of the buffer.
+      VK_CORE_ASSERT( !_released, "Buffers uploaded to more than once must be shared concurrently if global::transferEngine runs on a dedicated transfer queue." );
+      _released = true;
+    }
+
+    global::transferEngine.upload( data, size, _buffer.get( ), offset );
+
+    if ( release )
+    {
+      global::transferEngine.releaseBuffer( _buffer.get( ), vk::AccessFlagBits::eMemoryRead, vk::PipelineStageFlagBits::eAllCommands, global::graphicsFamilyIndex, offset, size );
+    }
+
+    global::transferEngine.commit( );
+  }
+
+  inline auto Buffer::copyToBuffer( const Buffer& buffer ) const -> TransferFuture
+  {
+    return copyToBuffer( buffer.get( ) );
+  }
+
+  inline auto Buffer::copyToBuffer( vk::Buffer buffer ) const -> TransferFuture
+  {
+    global::transferEngine.copyBuffer( _buffer.get( ), buffer, { vk::BufferCopy( 0, 0, _size ) } );
+    global::transferEngine.commit( );
+
+    return global::transferEngine.getFuture( );
+  }
+
+  inline auto Buffer::copyToImage( const Image& image ) const -> TransferFuture
+  {
+    return copyToImage( image.get( ), image.getExtent( ) );
+  }
+
+  inline auto Buffer::copyToImage( vk::Image image, vk::Extent3D extent ) const -> TransferFuture
+  {
+    vk::BufferImageCopy region( 0,                                            // bufferOffset
+                                0,                                            // bufferRowLength
+                                0,                                            // bufferImageHeight
+                                { vk::ImageAspectFlagBits::eColor, 0, 0, 1 }, // imageSubresource (aspectMask, mipLevel, baseArrayLayer, layerCount)
+                                vk::Offset3D { 0, 0, 0 },                     // imageOffset
+                                extent );                                     // imageExtent
+
+    global::transferEngine.getAcquireCommandBuffer( ).copyBufferToImage( _buffer.get( ), image, vk::ImageLayout::eTransferDstOptimal, 1, &region ); // CMD
+    global::transferEngine.commit( );
+
+    return global::transferEngine.getFuture( );
+  }
+
+  /// Transitions the image layout of any given image using global::transferEngine.
+  ///
+  /// The barrier is recorded on the graphics queue family, as the layouts might involve pipeline stages a transfer queue does not support.
+  /// @param image The vulkan image for which you want to change the image layout.
+  /// @param oldLayout The current image layout of the given vulkan image.
+  /// @param newLayout The target image layout.
+  /// @return Returns a future for the transition.
+  /// @note If a batch is open on global::transferEngine, the transition is recorded into it and the function returns without waiting for it.
+  inline auto transitionImageLayout( vk::Image image, vk::ImageLayout oldLayout, vk::ImageLayout newLayout ) -> TransferFuture
+  {
+    transitionImageLayout( image, oldLayout, newLayout, global::transferEngine.getAcquireCommandBuffer( ) );
+    global::transferEngine.commit( );
+
+    return global::transferEngine.getFuture( );
+  }
+
+  /// Records multiple image layout transitions into a single pipeline barrier using global::transferEngine.
+  ///
+  /// Like transitionImageLayout(vk::Image, vk::ImageLayout, vk::ImageLayout), the barrier is recorded on the graphics queue family.
+  /// @param transitions The transitions to record.
+  /// @return Returns a future for the transitions.
+  /// @note If a batch is open on global::transferEngine, the transitions are recorded into it and the function returns without waiting for them.
+  inline auto transitionImageLayouts( const std::vector<ImageTransition>& transitions ) -> TransferFuture
+  {
+    if ( !transitions.empty( ) )
+    {
+      transitionImageLayouts( transitions, global::transferEngine.getAcquireCommandBuffer( ) );
+      global::transferEngine.commit( );
+    }
+
+    return global::transferEngine.getFuture( );
+  }
+
+  /// Describes the contents of a KTX2 texture container.
+  struct Ktx2Info
+  {
+    vk::Format format         = vk::Format::eUndefined; ///< The format of the texel data, which may be block-compressed.
+    vk::Extent3D extent       = { };                    ///< The extent of the first mip level.
+    uint32_t mipLevels        = 1U;                     ///< The number of mip levels stored in the file.
+    vk::DeviceSize dataOffset = 0;                      ///< The file offset at which the levels' data begins.
+    vk::DeviceSize dataSize   = 0;                      ///< The size of all levels' data in bytes.
+    std::vector<vk::DeviceSize> levelOffsets;           ///< The offset of each mip level relative to dataOffset, starting with the first mip level.
+  };
+
+  /// Parses the header and level index of a KTX2 file.
+  ///
+  /// Only single-layer 2D textures with a Vulkan format and without supercompression are supported. Texel data is not read.
+  /// The level index is validated against the file's size and, if getTexelBlockInfo() knows the format, against the size each level's extent requires.
+  /// @param file The stream to read from, positioned at the beginning of the file.
+  /// @return Returns the texture's description.
+  inline auto readKtx2Info( std::istream& file ) -> Ktx2Info
+  {
+    constexpr std::array<uint8_t, 12> identifier = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+    // Identifier, nine 32-bit header fields and the index (four 32-bit and two 64-bit fields).
+    std::array<uint8_t, 80> header { };
+    file.read( reinterpret_cast<char*>( header.data( ) ), header.size( ) );
+
+    if ( !file || !std::equal( identifier.begin( ), identifier.end( ), header.begin( ) ) )
+    {
+      VK_CORE_THROW( "Failed to read KTX2 file: Invalid identifier." );
+    }
+
+    auto readUint32 = [&]( size_t offset ) {
+      uint32_t value = 0;
+      memcpy( &value, header.data( ) + offset, sizeof( value ) );
+      return value;
+    };
+
+    uint32_t vkFormat               = readUint32( 12 );
+    uint32_t pixelWidth             = readUint32( 20 );
+    uint32_t pixelHeight            = readUint32( 24 );
+    uint32_t pixelDepth             = readUint32( 28 );
+    uint32_t layerCount             = readUint32( 32 );
+    uint32_t faceCount              = readUint32( 36 );
+    uint32_t levelCount             = readUint32( 40 );
+    uint32_t supercompressionScheme = readUint32( 44 );
+
+    if ( vkFormat == VK_FORMAT_UNDEFINED )
+    {
+      VK_CORE_THROW( "Failed to read KTX2 file: Unsupported format. Transcodable formats (e.g. Basis Universal) are not supported." );
+    }
+
+    if ( supercompressionScheme != 0U )
+    {
+      VK_CORE_THROW( "Failed to read KTX2 file: Supercompressed textures are not supported." );
+    }
+
+    if ( pixelDepth > 1U || layerCount > 1U || faceCount != 1U )
+    {
+      VK_CORE_THROW( "Failed to read KTX2 file: Only 2D textures with a single layer are supported." );
+    }
+
+    Ktx2Info info;
+    info.format    = static_cast<vk::Format>( vkFormat );
+    info.extent    = vk::Extent3D( pixelWidth, std::max( pixelHeight, 1U ), 1U );
+    info.mipLevels = std::max( levelCount, 1U );
+
+    // Each level index entry consists of the level's byte offset, byte length and uncompressed byte length.
+    std::vector<uint64_t> levelIndex( static_cast<size_t>( info.mipLevels ) * 3 );
+    file.read( reinterpret_cast<char*>( levelIndex.data( ) ), static_cast<std::streamsize>( levelIndex.size( ) * sizeof( uint64_t ) ) );
+
+    if ( !file )
+    {
+      VK_CORE_THROW( "Failed to read KTX2 file: Incomplete level index." );
+    }
+
+    std::streampos indexEnd = file.tellg( );
+    file.seekg( 0, std::ios::end );
+    uint64_t fileSize = static_cast<uint64_t>( file.tellg( ) );
+    file.seekg( indexEnd );
+
+    auto blockInfo = getTexelBlockInfo( info.format );
+
+    // The levels are stored from smallest to largest, but they are not required to be contiguous.
+    uint64_t begin = std::numeric_limits<uint64_t>::max( );
+    uint64_t end   = 0;
+    for ( uint32_t level = 0; level < info.mipLevels; ++level )
+    {
+      uint64_t offset = levelIndex[level * 3];
+      uint64_t length = levelIndex[level * 3 + 1];
+
+      if ( length > fileSize || offset > fileSize - length )
+      {
+        VK_CORE_THROW( "Failed to read KTX2 file: Mip level ", level, " exceeds the file." );
+      }
+
+      // The copy regions of the levels are derived from the extent, so every level must hold at least as many bytes.
+      if ( blockInfo.first > 0 )
+      {
+        uint64_t width  = std::max( info.extent.width >> level, 1U );
+        uint64_t height = std::max( info.extent.height >> level, 1U );
+        uint64_t blocks = ( ( width + blockInfo.second.width - 1 ) / blockInfo.second.width ) * ( ( height + blockInfo.second.height - 1 ) / blockInfo.second.height );
+
+        if ( length < blocks * blockInfo.first )
+        {
+          VK_CORE_THROW( "Failed to read KTX2 file: Mip level ", level, " is smaller than its extent requires." );
+        }
+      }
+
+      begin = std::min( begin, offset );
+      end   = std::max( end, offset + length );
+    }
+
+    info.dataOffset = begin;
+    info.dataSize   = end - begin;
+
+    if ( info.dataOffset + info.dataSize > fileSize )
+    {
+      VK_CORE_THROW( "Failed to read KTX2 file: The level data exceeds the file." );
+    }
+
+    info.levelOffsets.reserve( info.mipLevels );
+    for ( uint32_t level = 0; level < info.mipLevels; ++level )
+    {
+      info.levelOffsets.push_back( levelIndex[level * 3] - begin );
+    }
+
+    return info;
+  }
+
+  /// A specialization class for creating textures using the sbt_image header.
+  /// @ingroup API
+  class Texture : public Image
+  {
+  public:
+    Texture( ) = default;
+
+    Texture( const Texture& ) = delete;
+    Texture( Texture&& )      = default;
+
+    auto operator=( const Texture& ) -> Texture& = delete;
+
+    /// Hands the image view, image and memory to global::deletionQueue if it is enabled and takes over those of another texture.
+    /// @param texture The texture to move from.
+    auto operator=( Texture&& texture ) -> Texture&
+    {
+      if ( this != &texture )
+      {
+        // The view is queued first, so it is destroyed before its image.
+        global::deletionQueue.push( _imageView );
+        Image::operator=( std::move( texture ) );
+
+        _path      = std::move( texture._path );
+        _imageView = std::move( texture._imageView );
+      }
+
+      return *this;
+    }
+
+    /// Hands the image view to global::deletionQueue if it is enabled.
+    ~Texture( )
+    {
+      global::deletionQueue.push( _imageView );
+    }
+
+    auto getImageView( ) const -> vk::ImageView { return _imageView.get( ); }
+
+    auto getPath( ) const -> const std::string& { return _path; }
+
+    /// Creates the texture.
+    /// @param path The relative path to the texture file.
+    /// @param generateMipmaps If true, a full mip chain will be allocated and generated on the GPU. Ignored if the format does not support blitting.
+    template <typename T>
+    void init( std::string_view path, const T* data, int width, int height, bool generateMipmaps = false )
+    {
+      // Defer the destruction of a previously created image view.
+      global::deletionQueue.push( _imageView );
+
+      _path = path;
+
+      vk::DeviceSize size = width * height * 4;
+
+      vk::Extent3D extent { static_cast<uint32_t>( width ), static_cast<uint32_t>( height ), 1 };
+
+      auto imageCreateInfo = getImageCreateInfo( extent );
+      if ( generateMipmaps )
+      {
+        vk::FormatFeatureFlags features = global::physicalDevice.getFormatProperties( imageCreateInfo.format ).optimalTilingFeatures;
+        if ( ( features & vk::FormatFeatureFlagBits::eBlitSrc ) && ( features & vk::FormatFeatureFlagBits::eBlitDst ) )
+        {
+          imageCreateInfo = getImageCreateInfo( extent, getMipLevelCount( extent ) );
+        }
+      }
+
+      Image::init( imageCreateInfo );
+
+      // Stage the pixels first, as staging might submit the command buffer currently being recorded.
+      StagingRegion staging = global::transferEngine.stage( data, size );
+
+      // Record both transitions and the copy into a single submission.
+      vk::CommandBuffer commandBuffer = global::transferEngine.getCommandBuffer( );
+
+      transitionToLayout( vk::ImageLayout::eTransferDstOptimal, commandBuffer );
+
+      vk::BufferImageCopy region( staging.offset,                               // bufferOffset
+                                  0,                                            // bufferRowLength
+                                  0,                                            // bufferImageHeight
+                                  { vk::ImageAspectFlagBits::eColor, 0, 0, 1 }, // imageSubresource (aspectMask, mipLevel, baseArrayLayer, layerCount)
+                                  vk::Offset3D { 0, 0, 0 },                     // imageOffset
+                                  _extent );                                    // imageExtent
+
+      commandBuffer.copyBufferToImage( staging.buffer, _image.get( ), vk::ImageLayout::eTransferDstOptimal, 1, &region ); // CMD
+
+      // Either way, all mip levels end up in the same layout.
+      if ( _mipLevels > 1U )
+      {
+        // Blits require a graphics queue, so the mip chain is generated once the image belongs to the graphics queue family.
+        commandBuffer = releaseToGraphics( vk::ImageLayout::eTransferDstOptimal );
+        Image::generateMipmaps( commandBuffer, vk::ImageLayout::eShaderReadOnlyOptimal );
+      }
+      else
+      {
+        releaseToGraphics( vk::ImageLayout::eShaderReadOnlyOptimal );
+      }
+
+      global::transferEngine.commit( );
+
+      _imageView = initImageViewUnique( getImageViewCreateInfo( _image.get( ), _format, vk::ImageViewType::e2D, vk::ImageAspectFlagBits::eColor, _mipLevels ) );
+    }
+
+    /// Creates the texture from a KTX2 file containing pre-compressed mip levels, e.g. BCn or ASTC.
+    ///
+    /// All mip levels are read straight into staging memory and uploaded with a single copy command.
+    /// @param path The relative path to the KTX2 file.
+    /// @note Throws if the device can not sample the file's format with optimal tiling.
+    void init( std::string_view path )
+    {
+      // Defer the destruction of a previously created image view.
+      global::deletionQueue.push( _imageView );
+
+      _path = path;
+
+      std::ifstream file( _path, std::ios::binary );
+      if ( !file.is_open( ) )
+      {
+        VK_CORE_THROW( "Failed to open KTX2 file ", _path );
+      }
+
+      Ktx2Info info = readKtx2Info( file );
+
+      findSupportedImageFormat( global::physicalDevice, { info.format }, vk::FormatFeatureFlagBits::eSampledImage, vk::ImageTiling::eOptimal );
+
+      auto imageCreateInfo      = getImageCreateInfo( info.extent );
+      imageCreateInfo.format    = info.format;
+      imageCreateInfo.mipLevels = info.mipLevels;
+      Image::init( imageCreateInfo );
+
+      // The file aligns every level to its texel block size. A multiple of all texel block sizes keeps the levels aligned inside the staging region.
+      StagingRegion staging = global::transferEngine.reserve( info.dataSize, 96 );
+
+      file.seekg( static_cast<std::streamoff>( info.dataOffset ) );
+      file.read( static_cast<char*>( staging.data ), static_cast<std::streamsize>( info.dataSize ) );
+
+      if ( !file )
+      {
+        VK_CORE_THROW( "Failed to read KTX2 file ", _path );
+      }
+
+      std::vector<vk::BufferImageCopy> regions;
+      regions.reserve( info.mipLevels );
+
+      for ( uint32_t level = 0; level < info.mipLevels; ++level )
+      {
+        vk::Extent3D extent( std::max( _extent.width >> level, 1U ), std::max( _extent.height >> level, 1U ), 1U );
+
+        vk::BufferImageCopy region( staging.offset + info.levelOffsets[level], // bufferOffset
+                                    0,                                         // bufferRowLength
+                                    0,                                         // bufferImageHeight
+                                    { _aspectMask, level, 0, 1 },              // imageSubresource (aspectMask, mipLevel, baseArrayLayer, layerCount)
+                                    vk::Offset3D { 0, 0, 0 },                  // imageOffset
+                                    extent );                                  // imageExtent
+
+        regions.push_back( region );
+      }
+
+      vk::CommandBuffer commandBuffer = global::transferEngine.getCommandBuffer( );
+
+      transitionToLayout( vk::ImageLayout::eTransferDstOptimal, commandBuffer );
+
+      commandBuffer.copyBufferToImage( staging.buffer, _image.get( ), vk::ImageLayout::eTransferDstOptimal, static_cast<uint32_t>( regions.size( ) ), regions.data( ) ); // CMD
+
+      releaseToGraphics( vk::ImageLayout::eShaderReadOnlyOptimal );
+
+      global::transferEngine.commit( );
+
+      _imageView = initImageViewUnique( getImageViewCreateInfo( _image.get( ), _format, vk::ImageViewType::e2D, _aspectMask, _mipLevels ) );
+    }
+
+  private:
+    /// Hands the entire texture over from global::transferEngine to the graphics queue family and transitions it to the given layout.
+    /// @param layout The layout of all subresources afterwards. All subresources must currently share the same layout.
+    /// @return Returns the command buffer further work on the texture can be recorded to on the graphics queue family.
+    auto releaseToGraphics( vk::ImageLayout layout ) -> vk::CommandBuffer
+    {
+      global::transferEngine.releaseImage( _image.get( ), getLayout( ), layout, resolveSubresourceRange( nullptr ) );
+      setLayout( layout );
+
+      return global::transferEngine.getAcquireCommandBuffer( );
+    }
+
+    std::string _path; ///< The relative path to the texture file.
+
+    vk::UniqueImageView _imageView;
+  };
+
+  /// Pixels decoded by the decoder of vkCore::TextureStreamer.
+  struct DecodedImage
+  {
+    std::vector<uint8_t> pixels; ///< Tightly packed 8-bit RGBA pixels. Leave empty to signal that decoding failed.
+    int width  = 0;              ///< The image's width in pixels.
+    int height = 0;              ///< The image's height in pixels.
+  };
+
+  /// A texture loaded in the background by vkCore::TextureStreamer.
+  ///
+  /// Until the texture is ready, getImageView() returns the image view of the streamer's placeholder texture.
+  /// @ingroup API
+  class StreamedTexture
+  {
+  public:
+    StreamedTexture( std::string_view path, bool generateMipmaps, std::shared_ptr<const Texture> placeholder ) :
+      _path( path ),
+      _generateMipmaps( generateMipmaps ),
+      _placeholder( std::move( placeholder ) )
     {
-      _mapped = false;
-      _size   = size;
+    }
 
-      vk::SharingMode sharingMode = queueFamilyIndices.size( ) > 1 ? vk::SharingMode::eConcurrent : vk::SharingMode::eExclusive;
+    auto getPath( ) const -> const std::string& { return _path; }
 
-      vk::BufferCreateInfo createInfo( { },                                                 // flags
-                                       size,                                                // size
-                                       usage,                                               // usage
-                                       sharingMode,                                         // sharingMode
-                                       static_cast<uint32_t>( queueFamilyIndices.size( ) ), // queueFamilyIndexCount
-                                       queueFamilyIndices.data( ) );                        // pQueueFamilyIndices
+    /// @return Returns true once the texture's data has been uploaded and it can be sampled.
+    auto isReady( ) const -> bool { return _ready; }
+
+    /// @return Returns true if the texture could not be decoded. The placeholder stays in use in that case.
+    auto hasFailed( ) const -> bool { return _failed; }
+
+    /// @return Returns the texture's image view if it is ready and the placeholder's image view otherwise.
+    auto getImageView( ) const -> vk::ImageView { return _ready ? _texture.getImageView( ) : _placeholder->getImageView( ); }
+
+    /// @return Returns the texture. Its resources are only valid once the texture is ready.
+    auto getTexture( ) const -> const Texture& { return _texture; }
+
+  private:
+    friend class TextureStreamer;
+
+    std::string _path;
+    bool _generateMipmaps = false;
+    bool _ready           = false;
+    bool _failed          = false;
+
+    std::shared_ptr<const Texture> _placeholder; ///< Keeps the placeholder alive for as long as this texture might use it.
+    Texture _texture;
+    TransferFuture _future; ///< The upload's submission.
+  };
+
+  /// Loads textures in the background.
+  ///
+  /// Files are decoded by a pool of worker threads using a user-provided decoder, e.g. one based on stb_image.
+  /// update() uploads decoded textures in batches through global::transferEngine without waiting for the uploads to finish and reports textures whose uploads have completed.
+  /// @note Apart from the decoder, everything runs on the thread calling request() and update().
+  /// @ingroup API
+  class TextureStreamer
+  {
+  public:
+    /// Decodes the file at the given path into 8-bit RGBA pixels. Called on a worker thread.
+    using Decoder = std::function<DecodedImage( const std::string& path )>;
+
+    /// Called by update() once a texture is ready or has failed to decode.
+    using Callback = std::function<void( const std::shared_ptr<StreamedTexture>& texture )>;
+
+    TextureStreamer( ) = default;
+
+    TextureStreamer( const TextureStreamer& )  = delete;
+    TextureStreamer( const TextureStreamer&& ) = delete;
+
+    auto operator=( const TextureStreamer& ) -> TextureStreamer& = delete;
+    auto operator=( const TextureStreamer&& ) -> TextureStreamer& = delete;
+
+    ~TextureStreamer( )
+    {
+      stopWorkers( );
+    }
+
+    /// @return Returns the texture used in place of textures that are not ready yet.
+    auto getPlaceholder( ) const -> const Texture& { return *_placeholder; }
+
+    /// @return Returns the number of requested textures that are neither ready nor failed.
+    auto getPendingCount( ) const -> size_t { return _pendingCount; }
+
+    /// Creates the placeholder texture and starts the worker threads.
+    /// @param decoder The function used to decode texture files.
+    /// @param threadCount The number of worker threads. If zero, one thread less than the hardware supports is used.
+    /// @param maxUploadsPerUpdate The maximum number of textures uploaded by a single call to update().
+    void init( Decoder decoder, uint32_t threadCount = 0, size_t maxUploadsPerUpdate = 8 )
+    {
+      VK_CORE_ASSERT( decoder, "No decoder was provided." );
+
+      stopWorkers( );
+
+      _decoder             = std::move( decoder );
+      _maxUploadsPerUpdate = std::max<size_t>( maxUploadsPerUpdate, 1 );
+
+      // Magenta makes textures that are still loading or failed to load easy to spot.
+      const std::array<uint8_t, 4> pixel = { 255, 0, 255, 255 };
+
+      auto placeholder = std::make_shared<Texture>( );
+      placeholder->init( "placeholder", pixel.data( ), 1, 1 );
+      _placeholder = std::move( placeholder );
+
+      if ( threadCount == 0 )
+      {
+        threadCount = std::max( std::thread::hardware_concurrency( ), 2U ) - 1U;
+      }
+
+      _stop = false;
+      _workers.reserve( threadCount );
+      for ( uint32_t i = 0; i < threadCount; ++i )
+      {
+        _workers.emplace_back( &TextureStreamer::work, this );
+      }
+    }
+
+    /// Queues a texture for decoding.
+    /// @param path The path to the texture file that is passed to the decoder.
+    /// @param generateMipmaps If true, a full mip chain will be generated on the GPU.
+    /// @param callback Optionally called by update() once the texture is ready or has failed to decode, e.g. to rewrite descriptors still referring to the placeholder.
+    /// @return Returns the texture.
+    auto request( std::string_view path, bool generateMipmaps = false, Callback callback = nullptr ) -> std::shared_ptr<StreamedTexture>
+    {
+      VK_CORE_ASSERT( _placeholder, "Texture streamer was not initialized." );
+
+      auto texture = std::make_shared<StreamedTexture>( path, generateMipmaps, _placeholder );
+
+      {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _requests.push_back( { texture, std::move( callback ), { } } );
+      }
+
+      _condition.notify_one( );
+      ++_pendingCount;
+
+      return texture;
+    }
+
+    /// Uploads decoded textures and reports completed ones. Call this once per frame.
+    ///
+    /// Up to maxUploadsPerUpdate textures are recorded into a single submission of global::transferEngine. The function does not wait for the submission.
+    /// If a batch is already open on global::transferEngine, the textures are recorded into it and submitted once it ends.
+    void update( )
+    {
+      // Report textures whose uploads have finished.
+      std::vector<Job> finished;
+      for ( auto it = _uploads.begin( ); it != _uploads.end( ); )
+      {
+        if ( it->texture->_future.isReady( ) )
+        {
+          it->texture->_ready = true;
+          finished.push_back( std::move( *it ) );
+          it = _uploads.erase( it );
+        }
+        else
+        {
+          ++it;
+        }
+      }
+
+      for ( Job& job : finished )
+      {
+        finish( job );
+      }
+
+      std::vector<Job> decoded;
+      {
+        std::lock_guard<std::mutex> lock( _mutex );
+
+        size_t count = std::min( _decoded.size( ), _maxUploadsPerUpdate );
+        decoded.reserve( count );
+
+        for ( size_t i = 0; i < count; ++i )
+        {
+          decoded.push_back( std::move( _decoded.front( ) ) );
+          _decoded.pop_front( );
+        }
+      }
+
+      if ( !decoded.empty( ) )
+      {
+        size_t first = _uploads.size( );
+
+        bool batching = global::transferEngine.isBatching( );
+        if ( !batching )
+        {
+          global::transferEngine.beginBatch( );
+        }
+
+        for ( Job& job : decoded )
+        {
+          DecodedImage& image = job.image;
+          if ( image.pixels.empty( ) || image.pixels.size( ) != static_cast<size_t>( image.width ) * image.height * 4 )
+          {
+            job.texture->_failed = true;
+            finish( job );
+            continue;
+          }
+
+          job.texture->_texture.init( job.texture->_path, image.pixels.data( ), image.width, image.height, job.texture->_generateMipmaps );
+
+          // The pixels have been staged and are no longer needed.
+          image = { };
+
+          _uploads.push_back( std::move( job ) );
+        }
+
+        // Within an outer batch, the uploads only become ready once the batch was submitted.
+        TransferFuture future = batching ? global::transferEngine.getFuture( ) : global::transferEngine.endBatch( );
+        for ( size_t i = first; i < _uploads.size( ); ++i )
+        {
+          _uploads[i].texture->_future = future;
+        }
+      }
+
+      global::transferEngine.collect( );
+    }
+
+    /// Stops the worker threads, waits for all uploads still executing and drops all textures that have not been uploaded yet.
+    /// @note Call this before global::transferEngine is destroyed and not while a batch update() recorded into is still open.
+    void destroy( )
+    {
+      stopWorkers( );
+
+      // The streamer might hold the last references to textures the device is still writing to.
+      for ( Job& job : _uploads )
+      {
+        job.texture->_future.wait( );
+      }
+
+      _requests.clear( );
+      _decoded.clear( );
+      _uploads.clear( );
+      _pendingCount = 0;
+      _placeholder  = nullptr;
+    }
+
+  private:
+    /// A single texture request on its way through the streamer.
+    struct Job
+    {
+      std::shared_ptr<StreamedTexture> texture;
+      Callback callback;
+      DecodedImage image;
+    };
+
+    /// The worker threads' main loop.
+    void work( )
+    {
+      for ( ;; )
+      {
+        Job job;
+
+        {
+          std::unique_lock<std::mutex> lock( _mutex );
+          _condition.wait( lock, [&]( ) { return _stop || !_requests.empty( ); } );
+
+          if ( _stop )
+          {
+            return;
+          }
+
+          job = std::move( _requests.front( ) );
+          _requests.pop_front( );
+        }
+
+        try
+        {
+          job.image = _decoder( job.texture->getPath( ) );
+        }
+        catch ( const std::exception& )
+        {
+          // The texture is reported as failed.
+          job.image = { };
+        }
+
+        std::lock_guard<std::mutex> lock( _mutex );
+        _decoded.push_back( std::move( job ) );
+      }
+    }
+
+    /// Reports a texture that is ready or has failed.
+    void finish( Job& job )
+    {
+      --_pendingCount;
+
+      if ( job.callback )
+      {
+        job.callback( job.texture );
+      }
+    }
+
+    void stopWorkers( )
+    {
+      {
+        std::lock_guard<std::mutex> lock( _mutex );
+        _stop = true;
+      }
+
+      _condition.notify_all( );
+
+      for ( std::thread& worker : _workers )
+      {
+        worker.join( );
+      }
+
+      _workers.clear( );
+    }
+
+    Decoder _decoder;
+    size_t _maxUploadsPerUpdate = 8;
+    size_t _pendingCount        = 0;
+    bool _stop                  = false; ///< Guarded by _mutex.
+
+    std::shared_ptr<const Texture> _placeholder;
+
+    std::mutex _mutex;
+    std::condition_variable _condition;
+    std::deque<Job> _requests; ///< Textures waiting to be decoded. Guarded by _mutex.
+    std::deque<Job> _decoded;  ///< Decoded textures waiting to be uploaded. Guarded by _mutex.
+    std::vector<Job> _uploads; ///< Textures whose uploads might still be executing.
+
+    std::vector<std::thread> _workers;
+  };
+
+  /// A shader storage buffer specilization class.
+  ///
+  /// Small buffers are placed in host visible device local memory if available, and upload(), uploadRanges() and append() write to them directly.
+  /// Unlike staged copies, direct writes are not ordered with the device's queues. A copy must not be written to while the device might still read it, e.g. keep one copy per frame in flight and only update the copy of the current frame.
+  /// @ingroup API
+  template <class T>
+  class StorageBuffer
+  {
+  public:
+    /// @return Returns the buffers holding the copies. If isSingleAllocation() is true, this is a single buffer holding all copies at the offsets returned by getOffset().
+    auto get( ) const -> const std::vector<Buffer>& { return _storageBuffers; }
+
+    auto get( size_t index ) const -> const vk::Buffer { return _storageBuffers[_singleAllocation ? 0 : index].get( ); }
+
+    /// @return Returns the offset of the copy at the given index within the Vulkan buffer returned by get(size_t).
+    auto getOffset( size_t index ) const -> vk::DeviceSize { return _singleAllocation ? index * _stride : 0; }
+
+    auto getCount( ) const -> uint32_t { return _count; }
+
+    /// @return Returns the amount of elements the buffer can hold without growing.
+    auto getCapacity( ) const -> size_t { return static_cast<size_t>( _maxSize / sizeof( T ) ); }
+
+    auto getDescriptorInfos( ) const -> const std::vector<vk::DescriptorBufferInfo>& { return _bufferInfos; }
+
+    /// @return Returns true if all copies live in a single buffer.
+    auto isSingleAllocation( ) const -> bool { return _singleAllocation; }
+
+    /// Sets a function that is called whenever the buffer grew, e.g. to rewrite descriptor sets referencing it.
+    /// @param callback The function receiving the new descriptor infos.
+    void setResizeCallback( std::function<void( const std::vector<vk::DescriptorBufferInfo>& )> callback )
+    {
+      _resizeCallback = std::move( callback );
+    }
+
+    /// Creates a storage buffer and n copies.
+    /// @param data The data to fill the storage buffer(s) with.
+    /// @param copies The amount of copies to make.
+    /// @param deviceAddressVisible If true, the buffer will be device visible.
+    /// @param singleAllocation If true, all copies will be placed in a single buffer at offsets aligned to minStorageBufferOffsetAlignment. The descriptor infos contain the matching offsets and ranges.
+    void init( const std::vector<T>& data, size_t copies = 1, bool deviceAddressVisible = false, bool singleAllocation = false )
+    {
+      _count = static_cast<uint32_t>( data.size( ) );
+
+      _copies               = copies;
+      _singleAllocation     = singleAllocation;
+      _deviceAddressVisible = deviceAddressVisible;
+
+      setCapacity( data.size( ) );
+
+      size_t bufferCount = singleAllocation ? 1 : copies;
+
+      _storageBuffers.resize( bufferCount );
+      _bufferInfos.resize( copies );
+
+      for ( size_t i = 0; i < bufferCount; ++i )
+      {
+        initBuffer( _storageBuffers[i] );
+      }
+
+      updateDescriptorInfos( );
+
+      upload( data );
+    }
+
+    /// Grows the buffer, so it can hold at least the given amount of elements.
+    ///
+    /// New buffers are created and the current contents are copied to them on the device using global::transferEngine.
+    /// The old buffers are kept alive until the copy has finished executing and are handed to global::deletionQueue afterwards. Finally, the resize callback is invoked.
+    /// @param capacity The minimum amount of elements.
+    /// @note If a batch is open on global::transferEngine, the function returns without waiting for the copy. Until the copy has finished, all uploads are staged.
+    void reserve( size_t capacity )
+    {
+      if ( capacity <= getCapacity( ) )
+      {
+        return;
+      }
+
+      std::vector<vk::DeviceSize> oldOffsets( _copies );
+      for ( size_t i = 0; i < _copies; ++i )
+      {
+        oldOffsets[i] = getOffset( i );
+      }
+
+      setCapacity( capacity );
+
+      vk::DeviceSize usedSize = sizeof( T ) * _count;
+
+      if ( usedSize > 0 )
+      {
+        // Earlier uploads and shader writes to the old buffers must finish before their contents are copied.
+        recordMemoryBarrier( global::transferEngine.getCommandBuffer( ),
+                             vk::AccessFlagBits::eMemoryWrite,
+                             vk::AccessFlagBits::eTransferRead,
+                             vk::PipelineStageFlagBits::eAllCommands,
+                             vk::PipelineStageFlagBits::eTransfer,
+                             TransferCommandBits::eAll,
+                             TransferCommandBits::eCopy );
+      }
+
+      for ( size_t i = 0; i < _storageBuffers.size( ); ++i )
+      {
+        auto replacement = std::make_shared<Buffer>( );
+        initBuffer( *replacement );
+
+        if ( usedSize > 0 )
+        {
+          std::vector<vk::BufferCopy> regions;
+
+          if ( _singleAllocation )
+          {
+            for ( size_t j = 0; j < _copies; ++j )
+            {
+              regions.emplace_back( oldOffsets[j], getOffset( j ), usedSize );
+            }
+          }
+          else
+          {
+            regions.emplace_back( 0, 0, usedSize );
+          }
+
+          global::transferEngine.copyBuffer( _storageBuffers[i].get( ), replacement->get( ), regions );
+        }
+
+        // The replacement now holds the old buffer, which must outlive the copy.
+        _storageBuffers[i].swap( *replacement );
+        global::transferEngine.retain( replacement );
+      }
+
+      if ( usedSize > 0 )
+      {
+        // Uploads recorded afterwards must not overtake the copies.
+        recordMemoryBarrier( global::transferEngine.getCommandBuffer( ),
+                             vk::AccessFlagBits::eTransferWrite,
+                             vk::AccessFlagBits::eTransferRead | vk::AccessFlagBits::eTransferWrite,
+                             vk::PipelineStageFlagBits::eTransfer,
+                             vk::PipelineStageFlagBits::eTransfer,
+                             TransferCommandBits::eCopy,
+                             TransferCommandBits::eCopy );
+
+        // Host writes would be overwritten by the copies, so uploads are staged until they have finished.
+        _growFuture = global::transferEngine.getFuture( );
+      }
+
+      global::transferEngine.commit( );
+
+      updateDescriptorInfos( );
+
+      if ( _resizeCallback )
+      {
+        _resizeCallback( _bufferInfos );
+      }
+    }
+
+    /// Changes the amount of elements. If the capacity is exceeded, it grows geometrically.
+    /// @param count The new amount of elements.
+    /// @note The contents of new elements are undefined until they are uploaded.
+    void resize( size_t count )
+    {
+      if ( count > getCapacity( ) )
+      {
+        reserve( std::max( count, getCapacity( ) * 2 ) );
+      }
+
+      _count = static_cast<uint32_t>( count );
+    }
+
+    /// Appends elements to the end of the buffer and grows it if necessary.
+    /// @param data The elements to append.
+    /// @param index Optionally used in case the data should only be appended to a specific buffer.
+    /// @note If a batch is open on global::transferEngine, the function returns without waiting for the upload.
+    void append( const std::vector<T>& data, std::optional<uint32_t> index = { } )
+    {
+      if ( data.empty( ) )
+      {
+        return;
+      }
+
+      vk::DeviceSize dstOffset = sizeof( T ) * _count;
+      vk::DeviceSize size      = sizeof( T ) * data.size( );
+
+      resize( _count + data.size( ) );
+
+      size_t first = index.has_value( ) ? index.value( ) : 0;
+      size_t last  = index.has_value( ) ? index.value( ) + 1 : _copies;
+
+      // Record the uploads to all copies into a single submission.
+      bool batching = global::transferEngine.isBatching( );
+      if ( !batching )
+      {
+        global::transferEngine.beginBatch( );
+      }
+
+      for ( size_t i = first; i < last; ++i )
+      {
+        if ( canWriteDirectly( i ) )
+        {
+          getBuffer( i ).upload( data.data( ), size, getOffset( i ) + dstOffset );
+        }
+        else
+        {
+          global::transferEngine.upload( data.data( ), size, get( i ), getOffset( i ) + dstOffset );
+        }
+      }
+
+      if ( !batching )
+      {
+        global::transferEngine.endBatch( ).wait( );
+      }
+    }
+
+    /// Uploads data to the buffer.
+    ///
+    /// First, the data is being copied to the staging ring of global::transferEngine which is visible to the host.
+    /// Finally, the staging memory is copied to the actual buffer on the device.
+    /// All copies are recorded into a single submission of global::transferEngine. If all copies live in a single buffer, the data is staged once and copied using a single copy command.
+    /// If the buffers live in host visible device local memory, the data is written directly instead, unless the copy of the old contents recorded by reserve() is still pending.
+    /// If the data exceeds the buffer's capacity, the buffer grows first.
+    /// @param index Optionally used in case the data should only be uploaded to a specific buffer.
+    /// @note If a batch is open on global::transferEngine, the function returns without waiting for the upload.
+    void upload( const std::vector<T>& data, std::optional<uint32_t> index = { } )
+    {
+      if ( data.size( ) > _count )
+      {
+        resize( data.size( ) );
+      }
+
+      vk::DeviceSize size = sizeof( T ) * data.size( );
+
+      if ( size == 0 )
+      {
+        return;
+      }
+
+      size_t first = index.has_value( ) ? index.value( ) : 0;
+      size_t last  = index.has_value( ) ? index.value( ) + 1 : _copies;
+
+      // Write directly to host visible device local memory. The allocator might have fallen back to memory that is not host visible for some of the buffers, so these are staged instead.
+      std::vector<size_t> staged;
+      for ( size_t i = first; i < last; ++i )
+      {
+        if ( !canWriteDirectly( i ) )
+        {
+          staged.push_back( i );
+          continue;
+        }
+
+        memcpy( static_cast<char*>( getBuffer( i ).getData( ) ) + getOffset( i ), data.data( ), static_cast<size_t>( size ) );
+        getBuffer( i ).markDirty( getOffset( i ), size );
+      }
+
+      if ( staged.size( ) < last - first && !global::transferEngine.isBatching( ) )
+      {
+        global::allocator.flush( );
+      }
 
-      _buffer = global::device.createBufferUnique( createInfo );
-      VK_CORE_ASSERT( _buffer.get( ), "Failed to create buffer." );
+      if ( staged.empty( ) )
+      {
+        return;
+      }
 
-      _memory = allocateMemoryUnique( _buffer, memoryPropertyFlags, pNextMemory );
-      global::device.bindBufferMemory( _buffer.get( ), _memory.get( ), 0 );
-    }
+      if ( _singleAllocation )
+      {
+        StagingRegion staging = global::transferEngine.stage( data.data( ), size );
 
-    /// Copies the content of this buffer to another RAYEX_NAMESPACE::Buffer.
-    /// @param buffer The target for the copy operation.
-    /// @param fence A fence to wait for when submitting the local single-time-use command buffer to the command queue.
-    void copyToBuffer( const Buffer& buffer, vk::Fence fence = nullptr ) const
-    {
-      copyToBuffer( buffer.get( ), fence );
-    }
+        std::vector<vk::BufferCopy> regions;
+        regions.reserve( staged.size( ) );
 
-    /// Copies the content of this buffer to another vk::Buffer.
-    /// @param buffer The target for the copy operation.
-    /// @param fence A fence to wait for when submitting the local single-time-use command buffer to the command queue.
-    void copyToBuffer( vk::Buffer buffer, vk::Fence fence = nullptr ) const
-    {
-      CommandBuffer commandBuffer( global::transferCmdPool );
-      commandBuffer.begin( );
+        for ( size_t i : staged )
+        {
+          regions.emplace_back( staging.offset, getOffset( i ), size );
+        }
+
+        global::transferEngine.copyBuffer( staging.buffer, get( first ), regions );
+      }
+      else
       {
-        vk::BufferCopy copyRegion( 0, 0, _size );
-        commandBuffer.get( 0 ).copyBuffer( _buffer.get( ), buffer, 1, &copyRegion ); // CMD
+        for ( size_t i : staged )
+        {
+          global::transferEngine.upload( data.data( ), size, get( i ) );
+        }
       }
-      commandBuffer.end( );
-      commandBuffer.submitToQueue( global::transferQueue, fence );
+
+      global::transferEngine.commit( );
     }
 
-    /// Copies the content of this buffer to an image.
-    /// @param image The target for the copy operation.
-    void copyToImage( const Image& image ) const
+    /// Uploads a single range of elements to the buffer.
+    /// @param data The data to upload. It is indexed the same way as the buffer.
+    /// @param elementOffset The index of the first element to upload.
+    /// @param elementCount The amount of elements to upload.
+    /// @param index Optionally used in case the data should only be uploaded to a specific buffer.
+    void uploadRange( const std::vector<T>& data, size_t elementOffset, size_t elementCount, std::optional<uint32_t> index = { } )
     {
-      copyToImage( image.get( ), image.getExtent( ) );
+      uploadRanges( data, { { elementOffset, elementCount } }, index );
     }
 
-    /// Copies the content of this buffer to an image.
-    /// @param image The target for the copy operation.
-    /// @param extent The target's extent.
-    void copyToImage( vk::Image image, vk::Extent3D extent ) const
+    /// Uploads a list of dirty element ranges to the buffer.
+    ///
+    /// The ranges are staged once and copied to each buffer using a single copy command with one region per range.
+    /// @param data The data to upload. It is indexed the same way as the buffer.
+    /// @param ranges Pairs of element offsets and element counts.
+    /// @param index Optionally used in case the data should only be uploaded to a specific buffer.
+    /// @note If a batch is open on global::transferEngine, the function returns without waiting for the upload.
+    void uploadRanges( const std::vector<T>& data, const std::vector<std::pair<size_t, size_t>>& ranges, std::optional<uint32_t> index = { } )
     {
-      CommandBuffer commandBuffer( global::graphicsCmdPool );
-      commandBuffer.begin( );
+      vk::DeviceSize size = 0;
+      for ( const auto& range : ranges )
       {
-        vk::BufferImageCopy region( 0,                                            // bufferOffset
-                                    0,                                            // bufferRowLength
-                                    0,                                            // bufferImageHeight
-                                    { vk::ImageAspectFlagBits::eColor, 0, 0, 1 }, // imageSubresource (aspectMask, mipLevel, baseArrayLayer, layerCount)
-                                    vk::Offset3D { 0, 0, 0 },                     // imageOffset
-                                    extent );                                     // imageExtent
+        VK_CORE_ASSERT( ( range.first + range.second <= data.size( ) ), "Dirty range exceeds the given data." );
+        VK_CORE_ASSERT( ( sizeof( T ) * ( range.first + range.second ) <= _maxSize ), "Exceeded maximum storage buffer size." );
 
-        commandBuffer.get( 0 ).copyBufferToImage( _buffer.get( ), image, vk::ImageLayout::eTransferDstOptimal, 1, &region ); // CMD
+        size += sizeof( T ) * range.second;
       }
-      commandBuffer.end( );
-      commandBuffer.submitToQueue( global::graphicsQueue );
-    }
 
-    /// Used to fill the buffer with the content of a given std::vector.
-    /// @param data The data to fill the buffer with.
-    /// @param offset The data's offset within the buffer.
-    template <class T>
-    void fill( const std::vector<T>& data, vk::DeviceSize offset = 0, std::optional<vk::DeviceSize> size = { } )
-    {
-      vk::DeviceSize actualSize = data.size( ) * sizeof( data[0] );
+      if ( size == 0 )
+      {
+        return;
+      }
+
+      size_t first = index.has_value( ) ? index.value( ) : 0;
+      size_t last  = index.has_value( ) ? index.value( ) + 1 : _copies;
 
-      // Only call mapMemory once or every time the buffer has been initialized again.
-      if ( !_mapped )
+      // Write directly to host visible device local memory. The allocator might have fallen back to memory that is not host visible for some of the buffers, so these are staged instead.
+      std::vector<size_t> staged;
+      for ( size_t i = first; i < last; ++i )
       {
-        _mapped = true;
+        if ( !canWriteDirectly( i ) )
+        {
+          staged.push_back( i );
+          continue;
+        }
 
-        if ( global::device.mapMemory( _memory.get( ), offset, actualSize, { }, &_ptrToData ) != vk::Result::eSuccess )
+        for ( const auto& range : ranges )
         {
-          VK_CORE_THROW( "Failed to map memory." );
+          memcpy( static_cast<char*>( getBuffer( i ).getData( ) ) + getOffset( i ) + sizeof( T ) * range.first, data.data( ) + range.first, sizeof( T ) * range.second );
+          getBuffer( i ).markDirty( getOffset( i ) + sizeof( T ) * range.first, sizeof( T ) * range.second );
         }
       }
 
-      VK_CORE_ASSERT( ( _ptrToData != nullptr ), "Failed to copy data to storage staging buffer." );
-      memcpy( _ptrToData, data.data( ), static_cast<uint32_t>( actualSize ) );
-    }
-
-    /// Used to fill the buffer by using a pointer and (optionally) passing the underlying memory size.
-    /// @param data The data to fill the buffer with.
-    /// @param offset The data's offset within the buffer.
-    /// @param size An optional size parameter to pass the size of data. If omitted, the size passed when calling init() will be used instead.
-    template <class T>
-    void fill( const T* data, vk::DeviceSize offset = 0, std::optional<vk::DeviceSize> size = { } )
-    {
-      vk::DeviceSize finalSize = _size;
-      if ( size.has_value( ) )
+      if ( staged.size( ) < last - first && !global::transferEngine.isBatching( ) )
       {
-        finalSize = size.value( );
+        global::allocator.flush( );
       }
 
-      // Only call mapMemory once or every time the buffer has been initialized again.
-      if ( !_mapped )
+      if ( staged.empty( ) )
       {
-        _mapped = true;
-
-        if ( global::device.mapMemory( _memory.get( ), offset, finalSize, { }, &_ptrToData ) != vk::Result::eSuccess )
-        {
-          VK_CORE_THROW( "Failed to map memory." );
-        }
+        return;
       }
 
-      VK_CORE_ASSERT( ( _ptrToData != nullptr ), "Failed to copy data to storage staging buffer." );
-      memcpy( _ptrToData, data, static_cast<uint32_t>( _size ) );
-      // @todo unmap memory in destructor
-    }
-
-  protected:
-    vk::UniqueBuffer _buffer;
-    vk::UniqueDeviceMemory _memory;
+      // Pack all ranges tightly into one staging region.
+      StagingRegion staging = global::transferEngine.reserve( size );
 
-    vk::DeviceSize _size = 0;
+      std::vector<vk::BufferCopy> regions;
+      regions.reserve( ranges.size( ) );
 
-    void* _ptrToData = nullptr;
-    bool _mapped     = false;
-  };
+      vk::DeviceSize packedOffset = 0;
+      for ( const auto& range : ranges )
+      {
+        vk::DeviceSize rangeSize = sizeof( T ) * range.second;
+        if ( rangeSize == 0 )
+        {
+          continue;
+        }
 
-  /// A specialization class for creating textures using the sbt_image header.
-  /// @ingroup API
-  class Texture : public Image
-  {
-  public:
-    auto getImageView( ) const -> vk::ImageView { return _imageView.get( ); }
+        memcpy( static_cast<char*>( staging.data ) + packedOffset, data.data( ) + range.first, static_cast<size_t>( rangeSize ) );
+        regions.emplace_back( staging.offset + packedOffset, sizeof( T ) * range.first, rangeSize );
 
-    auto getPath( ) const -> const std::string& { return _path; }
+        packedOffset += rangeSize;
+      }
 
-    /// Creates the texture.
-    /// @param path The relative path to the texture file.
-    template <typename T>
-    void init( std::string_view path, const T* data, int width, int height )
-    {
-      _path = path;
+      if ( _singleAllocation )
+      {
+        // One copy command with the regions of every copy.
+        std::vector<vk::BufferCopy> allRegions;
+        allRegions.reserve( regions.size( ) * staged.size( ) );
 
-      vk::DeviceSize size = width * height * 4;
+        for ( size_t i : staged )
+        {
+          for ( const auto& region : regions )
+          {
+            allRegions.emplace_back( region.srcOffset, region.dstOffset + getOffset( i ), region.size );
+          }
+        }
 
-      // Set up the staging buffer.
-      Buffer stagingBuffer( size,
-                            vk::BufferUsageFlagBits::eTransferSrc,
-                            { global::graphicsFamilyIndex },
-                            vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent );
+        global::transferEngine.copyBuffer( staging.buffer, get( first ), allRegions );
+      }
+      else
+      {
+        for ( size_t i : staged )
+        {
+          global::transferEngine.copyBuffer( staging.buffer, get( i ), regions );
+        }
+      }
 
-      stagingBuffer.fill<T>( data );
+      global::transferEngine.commit( );
+    }
 
-      auto imageCreateInfo = getImageCreateInfo( vk::Extent3D { static_cast<uint32_t>( width ), static_cast<uint32_t>( height ), 1 } );
-      Image::init( imageCreateInfo );
+  private:
+    auto getBuffer( size_t index ) -> Buffer& { return _storageBuffers[_singleAllocation ? 0 : index]; }
 
-      transitionToLayout( vk::ImageLayout::eTransferDstOptimal );
-      stagingBuffer.copyToImage( _image.get( ), _extent );
-      transitionToLayout( vk::ImageLayout::eShaderReadOnlyOptimal );
+    /// @param index The copy's index.
+    /// @return Returns true if the copy is host visible and no copy recorded by reserve() is pending that would overwrite host writes to it.
+    auto canWriteDirectly( size_t index ) -> bool
+    {
+      return getBuffer( index ).isHostVisible( ) && _growFuture.isReady( );
+    }
 
-      _imageView = initImageViewUnique( getImageViewCreateInfo( _image.get( ), _format ) );
+    /// Sets the size of a single copy and the distance between copies.
+    /// @param capacity The amount of elements.
+    void setCapacity( size_t capacity )
+    {
+      _maxSize = sizeof( T ) * capacity;
 
-      _path = path;
+      vk::DeviceSize alignment = std::max<vk::DeviceSize>( global::physicalDeviceLimits.minStorageBufferOffsetAlignment, 1 );
+      _stride                  = ( _maxSize + alignment - 1 ) / alignment * alignment;
+    }
 
-      /*
-      ktxTexture* texture = nullptr;
+    /// Creates a buffer large enough for the current capacity.
+    /// @param buffer The buffer to initialize.
+    void initBuffer( Buffer& buffer ) const
+    {
+      vk::MemoryAllocateFlagsInfo* allocateFlags = nullptr;
+      vk::MemoryAllocateFlagsInfo temp( vk::MemoryAllocateFlagBitsKHR::eDeviceAddress );
 
-      std::string temp( path );
+      // Growing the buffer copies the old contents on the device.
+      vk::BufferUsageFlags bufferUsageFlags = vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eStorageBuffer;
 
-      if ( ktxTexture_CreateFromNamedFile( temp.c_str( ), KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &texture ) != KTX_SUCCESS )
+      if ( _deviceAddressVisible )
       {
-        VK_CORE_THROW( "Failed to load KTX file from: ", temp );
+        allocateFlags = &temp;
+
+        // @todo Expose buffer usage flags and remove acceleration structure flag
+        bufferUsageFlags |= vk::BufferUsageFlagBits::eShaderDeviceAddress | vk::BufferUsageFlagBits::eAccelerationStructureBuildInputReadOnlyKHR;
       }
 
-      ktx_uint8_t* textureData = texture->pData;
-      ktx_size_t textureSize   = texture->dataSize;
-      uint32_t width           = texture->baseWidth;
-      uint32_t height          = texture->baseHeight;
-      uint32_t numLevels       = 1;
+      vk::DeviceSize size = _singleAllocation ? _stride * _copies : _maxSize;
 
-      // Set up the staging buffer.
-      Buffer stagingBuffer( textureSize,
-                            vk::BufferUsageFlagBits::eTransferSrc,
-                            { global::graphicsFamilyIndex },
-                            vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent );
+      // Prefer device local memory that is also host visible (UMA and ReBAR devices), so uploads can skip staging entirely.
+      // Large buffers would exhaust the heap, which is as small as 256 MB without resizable BAR, so they are always staged.
+      vk::MemoryPropertyFlags preferredMemoryPropertyFlags;
+      if ( size <= getHostVisibleDeviceLocalHeapSize( global::physicalDevice ) / 16 )
+      {
+        preferredMemoryPropertyFlags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+      }
 
-      stagingBuffer.fill<ktx_uint8_t>( textureData );
+      buffer.init( size,                                     // size
+                   bufferUsageFlags,                         // usage
+                   getSharedQueueFamilyIndices( ),           // queueFamilyIndices
+                   vk::MemoryPropertyFlagBits::eDeviceLocal, // memoryPropertyFlags
+                   allocateFlags,                            // pNextMemory
+                   false,                                    // dedicated
+                   preferredMemoryPropertyFlags );           // preferredMemoryPropertyFlags
+    }
 
-      auto imageCreateInfo = getImageCreateInfo( vk::Extent3D { static_cast<uint32_t>( width ), static_cast<uint32_t>( height ), 1 } );
-      Image::init( imageCreateInfo );
+    void updateDescriptorInfos( )
+    {
+      for ( size_t i = 0; i < _copies; ++i )
+      {
+        _bufferInfos[i].buffer = get( i );
+        _bufferInfos[i].offset = getOffset( i );
+        _bufferInfos[i].range  = _singleAllocation ? _maxSize : VK_WHOLE_SIZE;
+      }
+    }
 
-      transitionToLayout( vk::ImageLayout::eTransferDstOptimal );
-      stagingBuffer.copyToImage( _image.get( ), _extent );
-      transitionToLayout( vk::ImageLayout::eShaderReadOnlyOptimal );
+    std::vector<Buffer> _storageBuffers; ///< Holds the storage buffer and all its copies.
 
-      _imageView = initImageViewUnique( getImageViewCreateInfo( _image.get( ), _format ) );
+    std::vector<vk::DescriptorBufferInfo> _bufferInfos;
 
-      ktxTexture_Destroy( texture );
-      */
-    }
+    std::function<void( const std::vector<vk::DescriptorBufferInfo>& )> _resizeCallback; ///< Called after the buffer grew.
 
-  private:
-    std::string _path; ///< The relative path to the texture file.
+    TransferFuture _growFuture; ///< The submission copying the old contents since the buffer grew the last time.
 
-    vk::UniqueImageView _imageView;
+    vk::DeviceSize _maxSize    = 0; ///< The capacity of a single copy in bytes.
+    vk::DeviceSize _stride     = 0; ///< The distance between two copies if all copies live in a single buffer.
+    size_t _copies             = 0;
+    uint32_t _count            = 0;
+    bool _singleAllocation     = false;
+    bool _deviceAddressVisible = false;
   };
 
-  /// A shader storage buffer specilization class.
+  /// A frame-scoped linear allocator over one persistently mapped buffer.
+  ///
+  /// The buffer is split into one region per frame. Allocations are bumped from the current frame's region and the entire region is reset at once by beginFrame().
+  /// This is intended for per-draw constants bound as vk::DescriptorType::eUniformBufferDynamic, where each allocation's offset is passed as a dynamic offset.
+  /// @warning destroy() must be called before the logical device is destroyed.
   /// @ingroup API
-  template <class T>
-  class StorageBuffer
+  class LinearAllocator
   {
   public:
-    auto get( ) const -> const std::vector<Buffer>& { return _storageBuffers; }
+    /// @return Returns the Vulkan buffer all allocations live in.
+    auto getBuffer( ) const -> vk::Buffer { return _buffer ? _buffer->get( ) : nullptr; }
 
-    auto get( size_t index ) const -> const vk::Buffer { return _storageBuffers[index].get( ); }
+    /// @return Returns the size of each frame's region in bytes.
+    auto getFrameSize( ) const -> vk::DeviceSize { return _frameSize; }
 
-    auto getCount( ) const -> uint32_t { return _count; }
+    /// @return Returns the amount of frame regions.
+    auto getFrameCount( ) const -> uint32_t { return _frames; }
 
-    auto getDescriptorInfos( ) const -> const std::vector<vk::DescriptorBufferInfo>& { return _bufferInfos; }
+    /// @return Returns the amount of bytes allocated during the current frame.
+    auto getUsedSize( ) const -> vk::DeviceSize { return _head; }
 
-    /// Creates a storage buffer and n copies.
-    /// @param data The data to fill the storage buffer(s) with.
-    /// @param copies The amount of copies to make.
-    /// @param deviceAddressVisible If true, the buffer will be device visible.
-    void init( const std::vector<T>& data, size_t copies = 1, bool deviceAddressVisible = false )
+    /// @return Returns true if init() has been called.
+    auto isInitialized( ) const -> bool { return _buffer != nullptr; }
+
+    /// Creates the buffer.
+    /// @param frameSize The size of each frame's region in bytes.
+    /// @param frames The amount of frames that might be in flight at once.
+    /// @param usage The buffer's usage. The allocation alignment is derived from it.
+    /// @param preferCached If true, host cached memory is preferred over host coherent memory, e.g. if allocations are also read by the host. Allocations in non-coherent memory are flushed by global::allocator.flush().
+    void init( vk::DeviceSize frameSize, uint32_t frames = global::dataCopies, vk::BufferUsageFlags usage = vk::BufferUsageFlagBits::eUniformBuffer, bool preferCached = false )
     {
-      _count = static_cast<uint32_t>( data.size( ) );
+      _alignment = 1;
+      if ( usage & vk::BufferUsageFlagBits::eUniformBuffer )
+      {
+        _alignment = std::max( _alignment, global::physicalDeviceLimits.minUniformBufferOffsetAlignment );
+      }
 
-      _maxSize = sizeof( data[0] ) * data.size( );
+      if ( usage & vk::BufferUsageFlagBits::eStorageBuffer )
+      {
+        _alignment = std::max( _alignment, global::physicalDeviceLimits.minStorageBufferOffsetAlignment );
+      }
 
-      _stagingBuffers.resize( copies );
-      _storageBuffers.resize( copies );
-      _bufferInfos.resize( copies );
-      _fences.resize( copies );
+      _frameSize = ( frameSize + _alignment - 1 ) / _alignment * _alignment;
+      _frames    = frames;
+      _frame     = 0;
+      _head      = 0;
+
+      _buffer = std::make_unique<Buffer>( _frameSize * frames,
+                                          usage,
+                                          std::vector<uint32_t> { },
+                                          vk::MemoryPropertyFlagBits::eHostVisible,
+                                          nullptr,
+                                          false,
+                                          vk::MemoryPropertyFlagBits::eDeviceLocal | ( preferCached ? vk::MemoryPropertyFlagBits::eHostCached : vk::MemoryPropertyFlagBits::eHostCoherent ) );
+    }
 
-      vk::MemoryAllocateFlagsInfo* allocateFlags = nullptr;
-      vk::MemoryAllocateFlagsInfo temp( vk::MemoryAllocateFlagBitsKHR::eDeviceAddress );
+    /// Starts a new frame and resets the frame's region.
+    /// @param frame The index of the frame, e.g. the current frame in flight.
+    /// @param fence A fence that is signaled once the GPU has finished the frame that used the region before. If given, the function waits for it.
+    void beginFrame( uint32_t frame, vk::Fence fence = nullptr )
+    {
+      VK_CORE_ASSERT( ( frame < _frames ), "Frame index exceeds the amount of frames of the linear allocator." );
 
-      if ( deviceAddressVisible )
+      if ( fence )
       {
-        allocateFlags = &temp;
+        vk::Result result = global::device.waitForFences( 1, &fence, VK_TRUE, UINT64_MAX );
+        VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to wait for fences." );
       }
 
-      for ( size_t i = 0; i < copies; ++i )
-      {
-        _stagingBuffers[i].init( _maxSize,                                                                             // size
-                                 vk::BufferUsageFlagBits::eTransferSrc,                                                // usage
-                                 { global::transferFamilyIndex },                                                      // queueFamilyIndices
-                                 vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent, // memoryPropertyFlags
-                                 allocateFlags );
-
-        vk::BufferUsageFlags bufferUsageFlags = vk::BufferUsageFlagBits::eTransferDst | vk::BufferUsageFlagBits::eStorageBuffer;
-        if ( deviceAddressVisible )
-        {
-          // @todo Expose buffer usage flags and remove acceleration structure flag
-          bufferUsageFlags |= vk::BufferUsageFlagBits::eShaderDeviceAddress | vk::BufferUsageFlagBits::eAccelerationStructureBuildInputReadOnlyKHR;
-        }
+      _frame = frame;
+      _head  = 0;
+    }
 
-        _storageBuffers[i].init( _maxSize,                                 // size
-                                 bufferUsageFlags,                         // usage
-                                 { global::transferFamilyIndex },          // queueFamilyIndices
-                                 vk::MemoryPropertyFlagBits::eDeviceLocal, // memoryPropertyFlags
-                                 allocateFlags );
+    /// Allocates memory from the current frame's region.
+    /// @param size The allocation's size in bytes.
+    /// @return Returns the allocation's offset within the buffer (usable as a dynamic offset) and a pointer to its mapped memory.
+    /// @note The allocation is flushed by the next call to global::allocator.flush() in case the memory is not host coherent.
+    auto allocate( vk::DeviceSize size ) -> std::pair<uint32_t, void*>
+    {
+      VK_CORE_ASSERT( _buffer, "Linear allocator was not initialized." );
+      VK_CORE_ASSERT( ( _head + size <= _frameSize ), "Exceeded the linear allocator's frame size." );
 
-        _bufferInfos[i].buffer = _storageBuffers[i].get( );
-        _bufferInfos[i].offset = 0;
-        _bufferInfos[i].range  = VK_WHOLE_SIZE;
+      vk::DeviceSize offset = _frame * _frameSize + _head;
+      _head                 = ( _head + size + _alignment - 1 ) / _alignment * _alignment;
 
-        _fences[i] = initFenceUnique( vk::FenceCreateFlagBits::eSignaled );
-      }
+      _buffer->markDirty( offset, size );
 
-      upload( data );
+      return { static_cast<uint32_t>( offset ), static_cast<char*>( _buffer->getData( ) ) + offset };
     }
 
-    /// Uploads data to the buffer.
-    ///
-    /// First, the data is being copied to the staging buffer which is visible to the host.
-    /// Finally, the staging buffer is copied to the actual buffer on the device.
-    /// @param index Optionally used in case the data should only be uploaded to a specific buffer.
-    void upload( const std::vector<T>& data, std::optional<uint32_t> index = { } )
+    /// Copies data to the current frame's region.
+    /// @param data The data to copy.
+    /// @return Returns the data's offset within the buffer.
+    template <class T>
+    auto push( const T& data ) -> uint32_t
     {
-      VK_CORE_ASSERT( _maxSize >= sizeof( data[0] ) * data.size( ), "Exceeded maximum storage buffer size." );
+      auto allocation = allocate( sizeof( T ) );
+      memcpy( allocation.second, &data, sizeof( T ) );
 
-      if ( !index.has_value( ) )
-      {
-        for ( size_t i = 0; i < _storageBuffers.size( ); ++i )
-        {
-          _stagingBuffers[i].fill<T>( data );
-          _stagingBuffers[i].copyToBuffer( _storageBuffers[i].get( ) );
-        }
-      }
-      else
-      {
-        _stagingBuffers[index.value( )].fill<T>( data );
-        _stagingBuffers[index.value( )].copyToBuffer( _storageBuffers[index.value( )].get( ) );
-      }
+      return allocation.first;
     }
 
-  private:
-    std::vector<Buffer> _stagingBuffers; ///< Holds the staging buffer and all its copies.
-    std::vector<Buffer> _storageBuffers; ///< Holds the storage buffer and all its copies.
+    /// Destroys the buffer.
+    void destroy( )
+    {
+      _buffer.reset( );
+    }
 
-    std::vector<vk::DescriptorBufferInfo> _bufferInfos;
-    std::vector<vk::UniqueFence> _fences;
+  private:
+    std::unique_ptr<Buffer> _buffer;
 
-    vk::DeviceSize _maxSize = 0;
-    uint32_t _count         = 0;
+    vk::DeviceSize _frameSize = 0;
+    vk::DeviceSize _alignment = 1;
+    vk::DeviceSize _head      = 0; ///< The offset of the next allocation relative to the current frame's region.
+    uint32_t _frames          = 0U;
+    uint32_t _frame           = 0U; ///< The index of the current frame's region.
   };
 
+  namespace global
+  {
+    inline LinearAllocator uniformAllocator; ///< The linear allocator used by vkCore::UniformBuffer for dynamic uniform buffers.
+  } // namespace global
+
   /// A uniform buffer specialization class.
   /// @ingroup API
   template <class T>
@@ -1837,7 +6683,8 @@ namespace vkCore
     ///
     /// The function will create as many uniform buffers as there are images in the swapchain.
     /// Additionally, it will create the descriptor buffer infos which can be later used to write to a descriptor set.
-    void init( )
+    /// @param preferCached If true, host cached memory is preferred over host coherent memory. Uploads to non-coherent memory are flushed by global::allocator.flush().
+    void init( bool preferCached = false )
     {
       _buffers.resize( global::dataCopies );
 
@@ -1846,7 +6693,10 @@ namespace vkCore
         buffer.init( sizeof( T ),
                      vk::BufferUsageFlagBits::eUniformBuffer,
                      { },
-                     vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent );
+                     vk::MemoryPropertyFlagBits::eHostVisible,
+                     nullptr,
+                     false,
+                     preferCached ? vk::MemoryPropertyFlagBits::eHostCached : vk::MemoryPropertyFlagBits::eHostCoherent );
       }
 
       _bufferInfos.resize( global::dataCopies );
@@ -1865,6 +6715,23 @@ namespace vkCore
       _buffers[imageIndex].fill<T>( &ubo );
     }
 
+    /// Copies the uniform buffer object to the current frame's region of global::uniformAllocator.
+    ///
+    /// Unlike upload(uint32_t, T&), this does not require a buffer per object. Bind getDynamicDescriptorInfo() as vk::DescriptorType::eUniformBufferDynamic and pass the returned offset when binding the descriptor set.
+    /// @param ubo The actual uniform buffer object holding the data.
+    /// @return Returns the dynamic offset of the data.
+    /// @note global::uniformAllocator must have been initialized and global::uniformAllocator.beginFrame() must be called every frame.
+    auto uploadDynamic( const T& ubo ) -> uint32_t
+    {
+      return global::uniformAllocator.push<T>( ubo );
+    }
+
+    /// @return Returns the descriptor buffer info for a dynamic uniform buffer binding.
+    auto getDynamicDescriptorInfo( ) const -> vk::DescriptorBufferInfo
+    {
+      return vk::DescriptorBufferInfo( global::uniformAllocator.getBuffer( ), 0, sizeof( T ) );
+    }
+
     std::vector<vk::DescriptorBufferInfo> _bufferInfos;
 
   private:
@@ -2173,8 +7040,9 @@ namespace vkCore
     /// @param commandBuffer The command buffer used to begin the render pass.
     /// @param renderArea Defines the size of the render area.
     /// @param clearValues The clear values.
+    /// @param contents Use vk::SubpassContents::eSecondaryCommandBuffers if the subpass' commands are recorded to secondary command buffers.
     /// @note CommandBuffer::begin() or vk::CommandBuffer::begin() must have been already called prior to calling this function.
-    void begin( vk::Framebuffer framebuffer, vk::CommandBuffer commandBuffer, vk::Rect2D renderArea, const std::vector<vk::ClearValue>& clearValues ) const
+    void begin( vk::Framebuffer framebuffer, vk::CommandBuffer commandBuffer, vk::Rect2D renderArea, const std::vector<vk::ClearValue>& clearValues, vk::SubpassContents contents = vk::SubpassContents::eInline ) const
     {
       vk::RenderPassBeginInfo beginInfo( _renderPass.get( ),                           // renderPass
                                          framebuffer,                                  // framebuffer
@@ -2182,7 +7050,26 @@ namespace vkCore
                                          static_cast<uint32_t>( clearValues.size( ) ), // clearValueCount
                                          clearValues.data( ) );                        // pClearValues
 
-      commandBuffer.beginRenderPass( beginInfo, vk::SubpassContents::eInline );
+      commandBuffer.beginRenderPass( beginInfo, contents );
+    }
+
+    /// Call to advance to the next subpass.
+    /// @param commandBuffer The command buffer the render pass was begun with.
+    /// @param contents Use vk::SubpassContents::eSecondaryCommandBuffers if the subpass' commands are recorded to secondary command buffers.
+    void nextSubpass( vk::CommandBuffer commandBuffer, vk::SubpassContents contents = vk::SubpassContents::eInline ) const
+    {
+      commandBuffer.nextSubpass( contents );
+    }
+
+    /// Returns the inheritance info required to record secondary command buffers for this render pass.
+    /// @param framebuffer The framebuffer the secondary command buffers will be executed with. May be nullptr if unknown.
+    /// @param subpass The index of the subpass the secondary command buffers will be executed in.
+    /// @return Returns the Vulkan inheritance info.
+    auto getInheritanceInfo( vk::Framebuffer framebuffer = nullptr, uint32_t subpass = 0 ) const -> vk::CommandBufferInheritanceInfo
+    {
+      return vk::CommandBufferInheritanceInfo( _renderPass.get( ), // renderPass
+                                               subpass,            // subpass
+                                               framebuffer );      // framebuffer
     }
 
     /// Call to end the render pass.
@@ -2450,10 +7337,16 @@ namespace vkCore
     /// @param newLayout The target image layout.
     void setImageLayout( vk::ImageLayout oldLayout, vk::ImageLayout newLayout )
     {
+      std::vector<ImageTransition> transitions;
+      transitions.reserve( _images.size( ) );
+
       for ( const auto& image : _images )
       {
-        transitionImageLayout( image, oldLayout, newLayout );
+        transitions.push_back( { image, oldLayout, newLayout, { } } );
       }
+
+      // Transition all images using a single barrier and submission.
+      transitionImageLayouts( transitions );
     }
 
     /// Retrieves the next swapchain image.
@@ -2583,6 +7476,11 @@ namespace vkCore
     vk::DebugUtilsMessengerEXT _debugMessenger;
   };
 
+  /// Synchronizes the frames processed concurrently by the host and the device.
+  ///
+  /// Every frame started with beginFrame() advances global::frameCounter. If the device was created with timeline semaphores enabled, frame completion is tracked using a timeline semaphore whose value is the number of the most recently completed frame.
+  /// Otherwise, the in flight fences are used instead.
+  /// @ingroup API
   class Sync
   {
   public:
@@ -2590,29 +7488,184 @@ namespace vkCore
 
     auto getImageInFlight( size_t imageIndex ) -> vk::Fence { return _imagesInFlight[imageIndex]; }
 
+    /// @return Returns the in flight fence of the given slot or nullptr if timeline semaphores are used, as frame completion is tracked using the timeline semaphore instead.
     auto getInFlightFence( size_t imageIndex ) -> vk::Fence { return _inFlightFences[imageIndex].get( ); }
 
     auto getImageAvailableSemaphore( size_t imageIndex ) -> vk::Semaphore { return _imageAvailableSemaphores[imageIndex].get( ); }
 
     auto getFinishedRenderSemaphore( size_t imageIndex ) -> vk::Semaphore { return _finishedRenderSemaphores[imageIndex].get( ); }
 
-    void init( )
+    /// @return Returns true if frame completion is tracked using a timeline semaphore.
+    auto isTimelineEnabled( ) const -> bool { return static_cast<bool>( _timelineSemaphore ); }
+
+    /// @return Returns the timeline semaphore the submission of each frame must signal with the frame's number, or nullptr if timeline semaphores are not used.
+    auto getTimelineSemaphore( ) const -> vk::Semaphore { return _timelineSemaphore.get( ); }
+
+    /// @param maxFramesInFlight Defines the maximum amount of frames that will be processed concurrently.
+    /// @param useTimeline If true, a timeline semaphore is used if the device supports it.
+    void init( size_t maxFramesInFlight = 2, bool useTimeline = true )
     {
+      VK_CORE_ASSERT( ( maxFramesInFlight > 0 ), "At least one frame must be in flight." );
+      _maxFramesInFlight = maxFramesInFlight;
+
       _imageAvailableSemaphores.resize( _maxFramesInFlight );
       _finishedRenderSemaphores.resize( _maxFramesInFlight );
       _inFlightFences.resize( _maxFramesInFlight );
       _imagesInFlight.resize( global::swapchainImageCount, nullptr );
+      _frames.assign( _maxFramesInFlight, 0U );
+
+      _timelineSemaphore.reset( );
+      _completedFrame = global::frameCounter;
+
+#ifdef VK_API_VERSION_1_2
+      if ( useTimeline && global::timelineSemaphores )
+      {
+        vk::SemaphoreTypeCreateInfo typeCreateInfo( vk::SemaphoreType::eTimeline, // semaphoreType
+                                                    global::frameCounter );       // initialValue
+
+        vk::SemaphoreCreateInfo createInfo;
+        createInfo.pNext = &typeCreateInfo;
+
+        _timelineSemaphore = global::device.createSemaphoreUnique( createInfo );
+        VK_CORE_ASSERT( _timelineSemaphore, "Failed to create timeline semaphore." );
+      }
+#endif
 
       for ( size_t i = 0; i < _maxFramesInFlight; ++i )
       {
         _imageAvailableSemaphores[i] = vkCore::initSemaphoreUnique( );
         _finishedRenderSemaphores[i] = vkCore::initSemaphoreUnique( );
-        _inFlightFences[i]           = vkCore::initFenceUnique( vk::FenceCreateFlagBits::eSignaled );
+
+        // The timeline semaphore replaces the in flight fences.
+        _inFlightFences[i] = _timelineSemaphore ? vk::UniqueFence( ) : vkCore::initFenceUnique( vk::FenceCreateFlagBits::eSignaled );
+      }
+    }
+
+    /// Starts a new frame.
+    ///
+    /// Advances global::frameCounter, waits until the frame that used the same slot before has finished and, unless timeline semaphores are used, resets the slot's in flight fence.
+    /// Finally, global::deletionQueue and global::uniformAllocator are advanced to the new frame.
+    /// @return Returns the slot index in the range [0, getMaxFramesInFlight()) to pick the frame's synchronization objects with.
+    /// @note The frame's submission must signal the in flight fence of the returned slot. If timeline semaphores are used, it must signal getTimelineSemaphore() with global::frameCounter instead.
+    /// @note Call endFrame() before submitting the frame.
+    auto beginFrame( ) -> size_t
+    {
+      uint64_t frame = ++global::frameCounter;
+      size_t slot    = static_cast<size_t>( frame % _maxFramesInFlight );
+
+      if ( frame > _maxFramesInFlight )
+      {
+        waitForFrameNumber( frame - _maxFramesInFlight );
+      }
+
+      // Frames finish in order, so every frame up to the slot's previous frame has completed.
+      _completedFrame = std::max( _completedFrame, _frames[slot] );
+      _frames[slot]   = frame;
+
+      if ( !_timelineSemaphore )
+      {
+        // The fence must not be reset while its submission is pending.
+        waitForFrame( slot );
+
+        vk::Result result = global::device.resetFences( 1, &_inFlightFences[slot].get( ) );
+        VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to reset fences." );
+      }
+
+      global::deletionQueue.beginFrame( frame );
+      global::deletionQueue.release( getCompletedFrame( ) );
+
+      if ( global::uniformAllocator.isInitialized( ) )
+      {
+        VK_CORE_ASSERT( ( global::uniformAllocator.getFrameCount( ) >= _maxFramesInFlight ), "The uniform allocator has less frames than there are frames in flight." );
+        global::uniformAllocator.beginFrame( static_cast<uint32_t>( frame % global::uniformAllocator.getFrameCount( ) ) );
+      }
+
+      return slot;
+    }
+
+    /// Finishes the host side of the current frame.
+    ///
+    /// Flushes all host writes to non-coherent memory recorded during the frame using global::allocator.flush(), e.g. of global::uniformAllocator or vkCore::UniformBuffer.
+    /// @note Call this after writing the frame's data and before submitting the frame.
+    void endFrame( )
+    {
+      global::allocator.flush( );
+    }
+
+    /// Checks if the device has finished a frame without blocking.
+    /// @param frame The frame's number as returned by global::frameCounter.
+    /// @return Returns true if the frame has finished executing.
+    auto isFrameComplete( uint64_t frame ) -> bool
+    {
+      return frame <= getCompletedFrame( );
+    }
+
+    /// Queries the most recent frame the device has finished executing without blocking.
+    /// @return Returns the frame's number.
+    auto getCompletedFrame( ) -> uint64_t
+    {
+#ifdef VK_API_VERSION_1_2
+      if ( _timelineSemaphore )
+      {
+        _completedFrame = std::max( _completedFrame, global::device.getSemaphoreCounterValue( _timelineSemaphore.get( ) ) );
+        return _completedFrame;
+      }
+#endif
+
+      for ( size_t i = 0; i < _maxFramesInFlight; ++i )
+      {
+        if ( _frames[i] > _completedFrame && global::device.getFenceStatus( _inFlightFences[i].get( ) ) == vk::Result::eSuccess )
+        {
+          _completedFrame = _frames[i];
+        }
+      }
+
+      return _completedFrame;
+    }
+
+    /// Blocks until the device has finished a frame.
+    /// @param frame The frame's number as returned by global::frameCounter.
+    void waitForFrameNumber( uint64_t frame )
+    {
+      if ( frame <= _completedFrame )
+      {
+        return;
+      }
+
+#ifdef VK_API_VERSION_1_2
+      if ( _timelineSemaphore )
+      {
+        vk::Semaphore semaphore = _timelineSemaphore.get( );
+        vk::SemaphoreWaitInfo waitInfo( { },        // flags
+                                        1,          // semaphoreCount
+                                        &semaphore, // pSemaphores
+                                        &frame );   // pValues
+
+        vk::Result result = global::device.waitSemaphores( waitInfo, UINT64_MAX );
+        VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to wait for semaphores." );
+
+        _completedFrame = frame;
+        return;
       }
+#endif
+
+      size_t slot = static_cast<size_t>( frame % _maxFramesInFlight );
+      VK_CORE_ASSERT( ( _frames[slot] == frame ), "The frame is no longer tracked." );
+
+      waitForFrame( slot );
+      _completedFrame = frame;
     }
 
+    /// Blocks until the most recent frame started in the given slot has finished.
+    /// @param frame The slot index in the range [0, getMaxFramesInFlight()).
     void waitForFrame( size_t frame )
     {
+      if ( _timelineSemaphore )
+      {
+        waitForFrameNumber( _frames[frame] );
+        return;
+      }
+
       vk::Result result = global::device.waitForFences( 1, &_inFlightFences[frame].get( ), VK_TRUE, UINT64_MAX );
       VK_CORE_ASSERT( ( result == vk::Result::eSuccess ), "Failed to wait for fences." );
     }
@@ -2623,7 +7676,11 @@ namespace vkCore
     std::vector<vk::UniqueSemaphore> _imageAvailableSemaphores;
     std::vector<vk::UniqueSemaphore> _finishedRenderSemaphores;
 
+    vk::UniqueSemaphore _timelineSemaphore; ///< Signaled with the frame's number once a frame has finished. Only used if supported.
+    std::vector<uint64_t> _frames;          ///< The number of the most recent frame started in each slot.
+    uint64_t _completedFrame = 0U;          ///< The most recent frame known to have finished.
+
     // Defines the maximum amount of frames that will be processed concurrently.
-    const size_t _maxFramesInFlight = 2;
+    size_t _maxFramesInFlight = 2;
   };
 } // namespace vkCore